@@ -23,4 +23,23 @@ TEST_CASE("cxxtc::timecode arithmetic benchmarks", "[timecode][chrono][arithmeti
             return 0;
         };
     }
+
+    SECTION("frame stepping yields correct results") {
+        // source object
+        cxxtc::timecode tc1{};
+        std::size_t iterations = (59 * 25) + 24;
+
+        // control test
+        BENCHMARK("frame-step control with size_t to 1 minute") {
+            for (std::size_t i = 0; i < iterations; ++i);
+            return 0;
+        };
+
+        // benchmark
+        BENCHMARK("frame-step to 1 minute") {
+            tc1.reset();
+            for (std::size_t i = 0; i < iterations; ++i) tc1.step_frames();
+            return tc1.ticks();
+        };
+    }
 }
@@ -0,0 +1,73 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("cxxtc::parse_batch benchmarks", "[timecode][chrono][parse][batch]")
+{
+    SECTION("batch parsing a column of one day of labels") {
+        // source objects
+        std::vector<std::string> storage;
+        for (std::uint64_t frames = 0; frames < 2160000; frames += 17) {
+            storage.push_back(cxxtc::timecode{ frames * 100, cxxtc::fps::fps_25 });
+        }
+
+        std::vector<std::string_view> fields{ storage.begin(), storage.end() };
+        std::vector<std::uint64_t> ticks(fields.size());
+        std::vector<std::uint64_t> valid((fields.size() + 63) / 64);
+
+        // control test
+        BENCHMARK("string constructor per field") {
+            std::uint64_t total = 0;
+            for (const auto field : fields) total += cxxtc::timecode{ field, cxxtc::fps::fps_25 }.ticks();
+            return total;
+        };
+
+        // benchmark
+        BENCHMARK("batch parse with scalar kernel") {
+            return cxxtc::chrono::internal::__parse_batch<cxxtc::fps>(cxxtc::chrono::internal::__BatchIsa::scalar,
+                                                                     fields.size(),
+                                                                     [&](const std::size_t i) { return fields[i]; },
+                                                                     cxxtc::fps::fps_25, ticks, valid);
+        };
+
+        BENCHMARK("batch parse with widest kernel") {
+            return cxxtc::parse_batch(fields, cxxtc::fps::fps_25, ticks, valid);
+        };
+    }
+}
+
+TEST_CASE("cxxtc::format_batch benchmarks", "[timecode][chrono][format][batch]")
+{
+    SECTION("batch formatting one day of drop-frame labels") {
+        // source objects
+        std::vector<std::uint64_t> frames;
+        for (std::uint64_t f = 0; f < 2589408; f += 17) frames.push_back(f);
+
+        std::string out(frames.size() * 11, '\0');
+
+        // control test
+        BENCHMARK("string conversion per record") {
+            std::size_t total = 0;
+            for (const auto f : frames) total += static_cast<std::string>(cxxtc::timecode{ f * 100, cxxtc::fps::fpsdf_29p97 }).size();
+            return total;
+        };
+
+        // benchmark
+        BENCHMARK("batch format with scalar kernel") {
+            cxxtc::chrono::internal::__format_batch<cxxtc::fps>(cxxtc::chrono::internal::__BatchIsa::scalar,
+                                                                frames.size(),
+                                                                [&](const std::size_t i) { return frames[i]; },
+                                                                cxxtc::fps::fpsdf_29p97, out, 11);
+            return out[0];
+        };
+
+        BENCHMARK("batch format with widest kernel") {
+            cxxtc::format_batch(frames, cxxtc::fps::fpsdf_29p97, out);
+            return out[0];
+        };
+    }
+}
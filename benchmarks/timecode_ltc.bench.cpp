@@ -0,0 +1,61 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+TEST_CASE("cxxtc::encode_ltc benchmarks", "[timecode][ltc][batch]")
+{
+    SECTION("encoding a block of channels of drop-frame codewords") {
+        // source objects
+        std::vector<cxxtc::timecode> timecodes;
+        std::vector<cxxtc::ltc_fields> fields;
+        for (std::uint64_t frames = 0; frames < 2589408; frames += 17) {
+            timecodes.emplace_back(frames * 100, cxxtc::fps::fpsdf_29p97);
+            fields.push_back(cxxtc::ltc_fields{ static_cast<std::uint32_t>(frames), static_cast<std::uint8_t>(frames % 8) });
+        }
+
+        std::vector<cxxtc::ltc_codeword> codewords(timecodes.size());
+
+        // control test
+        BENCHMARK("string conversion per timecode") {
+            std::size_t total = 0;
+            for (const auto& tc : timecodes) total += static_cast<std::string>(tc).size();
+            return total;
+        };
+
+        // benchmark
+        BENCHMARK("batch encode") {
+            cxxtc::encode_ltc(timecodes, fields, codewords);
+            return codewords.back().data;
+        };
+    }
+}
+
+TEST_CASE("cxxtc::decode_ltc benchmarks", "[timecode][ltc][batch]")
+{
+    SECTION("decoding a block of channels of drop-frame codewords") {
+        // source objects
+        std::vector<cxxtc::ltc_codeword> codewords;
+        for (std::uint64_t frames = 0; frames < 2589408; frames += 17) {
+            codewords.push_back(cxxtc::encode_ltc(cxxtc::timecode{ frames * 100, cxxtc::fps::fpsdf_29p97 }));
+        }
+
+        std::vector<cxxtc::timecode> timecodes(codewords.size());
+        std::vector<cxxtc::ltc_fields> fields(codewords.size());
+        std::vector<std::uint64_t> valid((codewords.size() + 63) / 64);
+
+        // control test
+        BENCHMARK("decode per codeword") {
+            std::uint64_t total = 0;
+            for (const auto& codeword : codewords) total += cxxtc::decode_ltc(codeword, cxxtc::fps::fpsdf_29p97).value().tc.ticks();
+            return total;
+        };
+
+        // benchmark
+        BENCHMARK("batch decode") {
+            return cxxtc::decode_ltc(codewords, cxxtc::fps::fpsdf_29p97, timecodes, fields, valid);
+        };
+    }
+}
@@ -10,7 +10,28 @@
 // Library headers
 #include "timecode_common.hpp"
 #include "timecode_basic.hpp"
+#include "timecode_duration.hpp"
+#include "timecode_batch.hpp"
+#include "timecode_formats.hpp"
+#include "timecode_film.hpp"
+#include "timecode_audio.hpp"
+#include "timecode_chars.hpp"
+#include "timecode_ltc.hpp"
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <span>
+#include <string_view>
 #include <type_traits>
+#include <version>
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -32,17 +53,451 @@ namespace cxxtc::chrono {
 
 using fps = internal::__FPSFormat<float64_t, int64_t>;
 
-using timecode = internal::__BasicTimecodeInt<int64_t,
-                                              float64_t,
-                                              std::string,
-                                              std::string_view,
-                                              fps>;
+template<auto Rate>
+using fps_constant = internal::__FPSConstant<Rate, float64_t, int64_t>;
+
+namespace arithmetic {
+using unchecked  = internal::__ArithmeticUnchecked;
+using checked    = internal::__ArithmeticChecked;
+using saturating = internal::__ArithmeticSaturating;
+using wrap_day   = internal::__ArithmeticWrapDay;
+} // @END OF namespace cxxtc::chrono::arithmetic
+
+using rounding = internal::__Rounding;
+using parse_error = internal::__ParseError;
+using text_format = internal::__TextFormat;
+using film_gauge = internal::__FilmGauge;
+using feet_frames = internal::__FeetFrames;
+using keykode = internal::__KeyKode;
+using sample_rate = internal::__SampleRate;
+using sample_rates = internal::__SampleRates;
+using sample_cadence = internal::__SampleCadence;
+using ltc_codeword = internal::__LtcCodeword;
+using ltc_fields = internal::__LtcFields;
+
+template<internal::FpsFormatFactory TFps = fps, internal::ArithmeticPolicy TArith = arithmetic::unchecked>
+using basic_timecode = internal::__BasicTimecodeInt<int64_t,
+                                                    float64_t,
+                                                    std::string,
+                                                    std::string_view,
+                                                    TFps,
+                                                    TArith>;
+
+using timecode = basic_timecode<fps>;
+using ltc_frame = internal::__LtcFrame<timecode>;
+
+template<internal::FpsFormatFactory TFps = fps>
+using basic_timecode_duration = internal::__BasicTimecodeDuration<int64_t, TFps>;
+
+using timecode_duration = basic_timecode_duration<fps>;
+
+using internal::difference;
+
+// Parses a timecode string checked against its rate, for untrusted input: never
+// asserts or throws, malformed and out of range labels come back as a parse_error.
+// std::expected when the standard library has it.
+inline constexpr auto parse(const std::string_view tc, const fps::type rate = fps::default_value()) noexcept
+    -> cxxtc::utility::expected<timecode, parse_error>
+{
+    return timecode::parse(tc, rate);
+}
+
+// parse() for labels in other char types, e.g. UTF-16 from a Windows application,
+// without transcoding to std::string first
+inline constexpr auto parse(const std::wstring_view tc, const fps::type rate = fps::default_value()) noexcept
+    -> cxxtc::utility::expected<timecode, parse_error>
+{
+    return internal::__parse_chars<timecode>(tc, rate);
+}
+
+inline constexpr auto parse(const std::u8string_view tc, const fps::type rate = fps::default_value()) noexcept
+    -> cxxtc::utility::expected<timecode, parse_error>
+{
+    return internal::__parse_chars<timecode>(tc, rate);
+}
+
+inline constexpr auto parse(const std::u16string_view tc, const fps::type rate = fps::default_value()) noexcept
+    -> cxxtc::utility::expected<timecode, parse_error>
+{
+    return internal::__parse_chars<timecode>(tc, rate);
+}
+
+inline constexpr auto parse(const std::u32string_view tc, const fps::type rate = fps::default_value()) noexcept
+    -> cxxtc::utility::expected<timecode, parse_error>
+{
+    return internal::__parse_chars<timecode>(tc, rate);
+}
+
+// the shape of a timecode string, from its length and separator bytes alone
+inline constexpr auto detect_format(const std::string_view tc) noexcept -> text_format
+{
+    return internal::__classify_text(tc);
+}
+
+// Reads a timecode written in any of the formats mixed sources use: HH:MM:SS:FF,
+// HH:MM:SS;FF, HH:MM:SS.FF, HH:MM:SS:FF.SS, a raw frame count, or wall-clock
+// HH:MM:SS.mmm / HH:MM:SS,mmm converted at the exact rate. Each shape has its own
+// parser and is checked like parse().
+inline constexpr auto parse_any(const std::string_view tc, const fps::type rate = fps::default_value()) noexcept
+    -> cxxtc::utility::expected<timecode, parse_error>
+{
+    return internal::__read_timecode<timecode>(tc, rate);
+}
+
+// Writes tc into [first, last) like std::to_chars: no allocation and no locale,
+// in the format of its string conversion
+template<internal::FpsFormatFactory TFps, internal::ArithmeticPolicy TArith>
+inline auto to_chars(char* first, char* last, const basic_timecode<TFps, TArith>& tc) -> std::to_chars_result
+{
+    return tc.to_chars(first, last);
+}
+
+// Reads a label at the rate of tc like std::from_chars, tc is only changed on success
+template<internal::FpsFormatFactory TFps, internal::ArithmeticPolicy TArith>
+inline auto from_chars(const char* first, const char* last, basic_timecode<TFps, TArith>& tc) -> std::from_chars_result
+{
+    return basic_timecode<TFps, TArith>::from_chars(first, last, tc);
+}
+
+// Elapsed time of tc as a std::chrono::duration, e.g. to_duration<std::chrono::microseconds>(tc).
+// Integer math on the exact rational rate, with the rounding of a time between two units.
+template<cxxtc::traits::IntegralDuration TDuration, internal::FpsFormatFactory TFps, internal::ArithmeticPolicy TArith>
+inline constexpr auto to_duration(const basic_timecode<TFps, TArith>& tc, const rounding round = rounding::down) -> TDuration
+{
+    return tc.template to_duration<TDuration>(round);
+}
+
+// The timecode of the whole frame at an elapsed time, e.g. of a steady_clock
+// timestamp taken from the start of capture, with the rounding of a time between
+// two frames. Negative durations set the error flag.
+template<cxxtc::traits::IntegralDuration TDuration>
+inline constexpr auto from_duration(const TDuration time,
+                                    const fps::type rate = fps::default_value(),
+                                    const rounding round = rounding::down) -> timecode
+{
+    timecode tc{ 0, rate };
+    tc.set_duration(time, round);
+    return tc;
+}
+
+template<cxxtc::traits::WideCharType TChar>
+using to_chars_result = internal::__ToCharsResult<TChar>;
+
+template<cxxtc::traits::WideCharType TChar>
+using from_chars_result = internal::__FromCharsResult<TChar>;
+
+// to_chars and from_chars in other char types, results hold pointers of that type
+template<cxxtc::traits::WideCharType TChar, internal::FpsFormatFactory TFps, internal::ArithmeticPolicy TArith>
+inline auto to_chars(TChar* first, TChar* last, const basic_timecode<TFps, TArith>& tc) -> to_chars_result<TChar>
+{
+    return internal::__to_chars(first, last, tc, tc.chars_format());
+}
+
+template<cxxtc::traits::WideCharType TChar, internal::FpsFormatFactory TFps, internal::ArithmeticPolicy TArith>
+inline auto from_chars(const TChar* first, const TChar* last, basic_timecode<TFps, TArith>& tc) -> from_chars_result<TChar>
+{
+    return internal::__from_chars(first, last, tc);
+}
+
+// Reads up to out.size() whitespace separated labels at one rate with operator>>,
+// stopping at the first that fails to read. Returns the number read.
+inline auto read_timecodes(std::istream& in, const fps::type rate, std::span<timecode> out) -> std::size_t
+{
+    std::size_t count = 0;
+    for (; count < out.size(); ++count) {
+        timecode tc{ 0, rate };
+        if (!(in >> tc)) break;
+        out[count] = tc;
+    }
+
+    return count;
+}
+
+// same into an output iterator, e.g. std::back_inserter of a container
+template<std::output_iterator<const timecode&> TOutput>
+inline auto read_timecodes(std::istream& in, const fps::type rate, const std::size_t count, TOutput out) -> TOutput
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        timecode tc{ 0, rate };
+        if (!(in >> tc)) break;
+        *out++ = tc;
+    }
+
+    return out;
+}
+
+// Parses a column of timecode strings at one rate into tick counts. Bit i % 64 of
+// valid[i / 64] is set for each field that is a well-formed label of that rate,
+// invalid fields get zero ticks. Returns the number of valid fields. Uses the
+// widest vector kernel the CPU supports.
+inline auto parse_batch(std::span<const std::string_view> fields,
+                        const fps::type rate,
+                        std::span<std::uint64_t> ticks,
+                        std::span<std::uint64_t> valid) -> std::size_t
+{
+    return internal::__parse_batch<fps>(internal::__batch_isa_best(),
+                                        fields.size(),
+                                        [&](const std::size_t i) { return fields[i]; },
+                                        rate, ticks, valid);
+}
+
+// same for count fixed-length fields laid out every stride bytes, e.g. a column
+// of a fixed-width log record
+inline auto parse_batch(const char* data,
+                        const std::size_t stride,
+                        const std::size_t length,
+                        const std::size_t count,
+                        const fps::type rate,
+                        std::span<std::uint64_t> ticks,
+                        std::span<std::uint64_t> valid) -> std::size_t
+{
+    return internal::__parse_batch<fps>(internal::__batch_isa_best(),
+                                        count,
+                                        [=](const std::size_t i) { return std::string_view{ data + (i * stride), length }; },
+                                        rate, ticks, valid);
+}
+
+// Writes a fixed-width HH:MM:SS:FF record for each frame count at one rate, the
+// i-th record starts at out[i * stride] and chars between records are left as
+// they are, e.g. a stride of 12 leaves room for a delimiter. Nothing is allocated.
+inline void format_batch(std::span<const std::uint64_t> frames,
+                         const fps::type rate,
+                         std::span<char> out,
+                         const std::size_t stride = 11)
+{
+    internal::__format_batch<fps>(internal::__batch_isa_best(),
+                                  frames.size(),
+                                  [&](const std::size_t i) { return frames[i]; },
+                                  rate, out, stride);
+}
+
+// same for timecodes, each at its own rate with subframes dropped; runs of
+// timecodes sharing a rate are formatted together
+inline void format_batch(std::span<const timecode> timecodes,
+                         std::span<char> out,
+                         const std::size_t stride = 11)
+{
+    std::size_t first = 0;
+    while (first < timecodes.size()) {
+        const fps::type rate = timecodes[first].fps();
+
+        std::size_t last = first + 1;
+        while (last < timecodes.size() && timecodes[last].fps() == rate) ++last;
+
+        internal::__format_batch<fps>(internal::__batch_isa_best(),
+                                      last - first,
+                                      [&](const std::size_t i) { return std::uint64_t{ timecodes[first + i].ticks() / 100 }; },
+                                      rate, out.subspan(first * stride), stride);
+        first = last;
+    }
+}
+
+// The sample position of tc at an exact sample rate, e.g. sample_rates::khz_48 or
+// the pull-down sample_rates::khz_47p952, in integer math on both rational rates.
+// Nearest rounding puts frame boundaries on the samples of cadence().
+inline constexpr auto to_samples(const timecode& tc, const sample_rate rate, const rounding round = rounding::nearest) -> std::uint64_t
+{
+    return internal::__convert_ticks(std::uint64_t{ tc.ticks() }, internal::__ticks_to_samples(tc, rate), round);
+}
+
+// the timecode of a sample position, to the subframe
+inline constexpr auto from_samples(const std::uint64_t samples,
+                                   const sample_rate rate,
+                                   const fps::type fps = fps::default_value(),
+                                   const rounding round = rounding::nearest) -> timecode
+{
+    const timecode zero{ 0, fps };
+    return timecode{ internal::__convert_ticks(samples, internal::__samples_to_ticks(zero, rate), round), fps };
+}
+
+// batch versions of the above, the rate ratio is reduced once per run of a rate
+inline void to_samples(std::span<const timecode> timecodes,
+                       const sample_rate rate,
+                       std::span<std::uint64_t> samples,
+                       const rounding round = rounding::nearest)
+{
+    internal::__to_samples_batch(timecodes, rate, samples, round);
+}
+
+inline void from_samples(std::span<const std::uint64_t> samples,
+                         const sample_rate rate,
+                         const fps::type fps,
+                         std::span<timecode> timecodes,
+                         const rounding round = rounding::nearest)
+{
+    internal::__from_samples_batch(samples, rate, fps, timecodes, round);
+}
+
+// The samples in each frame at a frame rate and sample rate, e.g. the 1602/1601
+// pattern of 48 kHz at 29.97: cadence(fps::fps_29p97, sample_rates::khz_48)[i]
+inline constexpr auto cadence(const fps::type fps, const sample_rate rate) -> sample_cadence
+{
+    return internal::__init_sample_cadence(fps::to_rational(fps), rate);
+}
+
+// The footage of the frame of tc on film of a gauge, one film frame per timecode
+// frame and subframes dropped. Integer arithmetic on perforations throughout.
+inline constexpr auto to_feet_frames(const timecode& tc, const film_gauge gauge) -> feet_frames
+{
+    return internal::__to_feet_frames(tc.ticks() / 100, gauge);
+}
+
+inline constexpr auto from_feet_frames(const feet_frames& footage, const fps::type rate = fps::default_value()) -> timecode
+{
+    return timecode{ internal::__from_feet_frames(footage) * 100, rate };
+}
+
+// The edge number of the frame of tc, from the KeyKode sync_key read at the frame
+// sync_tc, e.g. from a telecine log. The result is on the roll of sync_key.
+inline constexpr auto to_keykode(const timecode& tc, const timecode& sync_tc, const keykode& sync_key) -> keykode
+{
+    keykode result{};
+    internal::__keykode_batch(1,
+                              [&](std::size_t) { return (static_cast<std::int64_t>(tc.ticks()) - static_cast<std::int64_t>(sync_tc.ticks())) / 100; },
+                              sync_key, std::span<keykode>{ &result, 1 });
+    return result;
+}
+
+// The timecode of the frame at key, at the rate of sync_tc. key must be on the
+// roll of sync_key; frames before timecode zero set the error flag.
+inline constexpr auto from_keykode(const keykode& key, const timecode& sync_tc, const keykode& sync_key) -> timecode
+{
+    assert(key.manufacturer == sync_key.manufacturer && key.prefix == sync_key.prefix && key.gauge == sync_key.gauge
+           && "KeyKode passed to cxxtc::chrono::from_keykode is not on the roll of the sync KeyKode");
+
+    const std::int64_t offset = static_cast<std::int64_t>(internal::__keykode_to_roll_frames(key))
+                              - static_cast<std::int64_t>(internal::__keykode_to_roll_frames(sync_key));
+    return timecode{ static_cast<std::int64_t>(sync_tc.ticks()) + (offset * 100), sync_tc.fps() };
+}
+
+// batch versions of the above, the gauge and sync point are resolved once
+inline void to_feet_frames(std::span<const timecode> timecodes, const film_gauge gauge, std::span<feet_frames> out)
+{
+    internal::__to_feet_frames_batch(timecodes.size(),
+                                     [&](const std::size_t i) { return std::uint64_t{ timecodes[i].ticks() / 100 }; },
+                                     gauge, out);
+}
+
+inline void from_feet_frames(std::span<const feet_frames> footage, const fps::type rate, std::span<timecode> out)
+{
+    assert(out.size() >= footage.size() && "output span of cxxtc::chrono::from_feet_frames is too small");
+    for (std::size_t i = 0; i < footage.size(); ++i) out[i] = from_feet_frames(footage[i], rate);
+}
+
+inline void to_keykode(std::span<const timecode> timecodes, const timecode& sync_tc, const keykode& sync_key, std::span<keykode> out)
+{
+    const auto sync = static_cast<std::int64_t>(sync_tc.ticks());
+    internal::__keykode_batch(timecodes.size(),
+                              [&](const std::size_t i) { return (static_cast<std::int64_t>(timecodes[i].ticks()) - sync) / 100; },
+                              sync_key, out);
+}
+
+inline void from_keykode(std::span<const keykode> keys, const timecode& sync_tc, const keykode& sync_key, std::span<timecode> out)
+{
+    assert(out.size() >= keys.size() && "output span of cxxtc::chrono::from_keykode is too small");
+    for (std::size_t i = 0; i < keys.size(); ++i) out[i] = from_keykode(keys[i], sync_tc, sync_key);
+}
+
+// The 80 bit LTC codeword of tc at 30 fps or less, with the user bits, color frame
+// and binary group flags of fields. The drop-frame flag follows the rate of tc and
+// the polarity correction bit is computed.
+inline constexpr auto encode_ltc(const timecode& tc, const ltc_fields& fields = {}) -> ltc_codeword
+{
+    return internal::__encode_ltc(tc, fields);
+}
+
+// The timecode and fields of a codeword at a rate of 30 fps or less, or why it
+// does not decode: a missing sync word, a bad digit or a drop-frame flag that does
+// not match the rate is invalid_format, labels outside the rate fail as in parse()
+inline constexpr auto decode_ltc(const ltc_codeword& codeword, const fps::type rate = fps::default_value())
+    -> cxxtc::utility::expected<ltc_frame, parse_error>
+{
+    return internal::__decode_ltc<timecode>(codeword, rate);
+}
+
+// batch versions of the above for a block of codewords, e.g. one per channel. Bit
+// i % 64 of valid[i / 64] is set for each codeword that decodes, the others get
+// a zero timecode and empty fields. Returns the number that decode.
+inline void encode_ltc(std::span<const timecode> timecodes, std::span<const ltc_fields> fields, std::span<ltc_codeword> out)
+{
+    internal::__encode_ltc_batch(timecodes, fields, out);
+}
+
+inline auto decode_ltc(std::span<const ltc_codeword> codewords,
+                       const fps::type rate,
+                       std::span<timecode> timecodes,
+                       std::span<ltc_fields> fields,
+                       std::span<std::uint64_t> valid) -> std::size_t
+{
+    return internal::__decode_ltc_batch(codewords, rate, timecodes, fields, valid);
+}
+
+// FEET+FF, e.g. 1234+05
+inline auto to_chars(char* first, char* last, const feet_frames& footage) -> std::to_chars_result
+{
+    return internal::__feet_frames_to_chars(first, last, footage);
+}
+
+// reads FEET+FF at the gauge of footage, footage is only changed on success
+inline auto from_chars(const char* first, const char* last, feet_frames& footage) -> std::from_chars_result
+{
+    return internal::__feet_frames_from_chars(first, last, footage);
+}
+
+// MM PP PPPP CCCC+FF, e.g. KU 22 9012 3456+12
+inline auto to_chars(char* first, char* last, const keykode& key) -> std::to_chars_result
+{
+    return internal::__keykode_to_chars(first, last, key);
+}
+
+// reads MM PP PPPP CCCC+FF, the gauge of key is kept and key is only changed on success
+inline auto from_chars(const char* first, const char* last, keykode& key) -> std::from_chars_result
+{
+    return internal::__keykode_from_chars(first, last, key);
+}
 
 } // @END OF namespace cxxtc::chrono
 
 ///////////////////////////////////////////////////////////////////////////
 
 
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Timecode Literals cxxtc::chrono::literals --
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Timecodes parsed and checked during compilation: "01:00:00:00"_tc25,
+// "00:59:59;29"_tcdf. _tc uses the default fps.
+namespace cxxtc::chrono::literals {
+
+#define __TIMECODE_LITERAL(suffix, rate)                                                 \
+consteval auto operator"" suffix(const char* tc, const std::size_t length) -> timecode   \
+{                                                                                        \
+    return timecode::__from_literal(tc, length, rate);                                   \
+}
+
+__TIMECODE_LITERAL(_tc,       fps::default_value())
+__TIMECODE_LITERAL(_tc24,     fps::fps_24)
+__TIMECODE_LITERAL(_tc25,     fps::fps_25)
+__TIMECODE_LITERAL(_tc30,     fps::fps_30)
+__TIMECODE_LITERAL(_tc48,     fps::fps_48)
+__TIMECODE_LITERAL(_tc50,     fps::fps_50)
+__TIMECODE_LITERAL(_tc60,     fps::fps_60)
+__TIMECODE_LITERAL(_tc100,    fps::fps_100)
+__TIMECODE_LITERAL(_tc23976,  fps::fps_23p976)
+__TIMECODE_LITERAL(_tc2997,   fps::fps_29p97)
+__TIMECODE_LITERAL(_tc5994,   fps::fps_59p94)
+__TIMECODE_LITERAL(_tcdf,     fps::fpsdf_29p97)
+__TIMECODE_LITERAL(_tcdf5994, fps::fpsdf_59p94)
+
+#undef __TIMECODE_LITERAL
+
+} // @END OF namespace cxxtc::chrono::literals
+
+///////////////////////////////////////////////////////////////////////////
+
+
 ///////////////////////////////////////////////////////////////////////////
 //
 //           -- @SECTION Public Interface cxxtc --
@@ -54,12 +509,72 @@ namespace cxxtc {
 // @SECTION: VTM timecode object aliases
 using timecode = chrono::timecode;
 
+namespace arithmetic = chrono::arithmetic;
+using rounding = chrono::rounding;
+using parse_error = chrono::parse_error;
+using text_format = chrono::text_format;
+
+template<cxxtc::traits::WideCharType TChar>
+using to_chars_result = chrono::to_chars_result<TChar>;
+
+template<cxxtc::traits::WideCharType TChar>
+using from_chars_result = chrono::from_chars_result<TChar>;
+using film_gauge = chrono::film_gauge;
+using feet_frames = chrono::feet_frames;
+using keykode = chrono::keykode;
+using sample_rate = chrono::sample_rate;
+using sample_rates = chrono::sample_rates;
+using sample_cadence = chrono::sample_cadence;
+using ltc_codeword = chrono::ltc_codeword;
+using ltc_fields = chrono::ltc_fields;
+using ltc_frame = chrono::ltc_frame;
+
+template<chrono::internal::FpsFormatFactory TFps = chrono::fps,
+         chrono::internal::ArithmeticPolicy TArith = chrono::arithmetic::unchecked>
+using basic_timecode = chrono::basic_timecode<TFps, TArith>;
+
+template<std::size_t N, typename TChar = char>
+using static_string = utility::static_string<N, TChar>;
+
+using timecode_duration = chrono::timecode_duration;
+
+template<chrono::internal::FpsFormatFactory TFps = chrono::fps>
+using basic_timecode_duration = chrono::basic_timecode_duration<TFps>;
+
+using chrono::difference;
+using chrono::parse;
+using chrono::parse_any;
+using chrono::detect_format;
+using chrono::to_chars;
+using chrono::from_chars;
+using chrono::read_timecodes;
+using chrono::to_duration;
+using chrono::from_duration;
+using chrono::parse_batch;
+using chrono::format_batch;
+using chrono::to_feet_frames;
+using chrono::from_feet_frames;
+using chrono::to_keykode;
+using chrono::from_keykode;
+using chrono::to_samples;
+using chrono::from_samples;
+using chrono::cadence;
+using chrono::encode_ltc;
+using chrono::decode_ltc;
+
+namespace literals {
+using namespace chrono::literals;
+} // @END OF namespace cxxtc::literals
+
 // @SECTION: VTM FPS factory object aliases
 using fps = chrono::fps;
 using fpsfloat_t = typename chrono::fps::float_type;
 using fpsint_t = typename chrono::fps::signed_type;
 using fpsuint_t = typename chrono::fps::unsigned_type;
 
+template<auto Rate>
+using fps_constant = chrono::fps_constant<Rate>;
+
 } // @END OF namespace cxxtc
 
 ///////////////////////////////////////////////////////////////////////////
@@ -73,20 +588,82 @@ using fpsuint_t = typename chrono::fps::unsigned_type;
 
 namespace std {
 // @SECTION: __BasicTimecodeInt std::tuplee specialization
-template<>
-struct tuple_size<cxxtc::timecode> : std::integral_constant<std::size_t, 6>{}; // TODO: constant for magic number
+template<std::integral TInt,
+         std::floating_point TFloat,
+         cxxtc::traits::StringLike TString,
+         cxxtc::traits::StringLike TView,
+         cxxtc::chrono::internal::FpsFormatFactory TFps,
+         cxxtc::chrono::internal::ArithmeticPolicy TArith>
+struct tuple_size<cxxtc::chrono::internal::__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>>
+    : std::integral_constant<std::size_t, 6>{}; // TODO: constant for magic number
 
-template<std::size_t Index>
-struct tuple_element<Index, cxxtc::timecode>
+template<std::size_t Index,
+         std::integral TInt,
+         std::floating_point TFloat,
+         cxxtc::traits::StringLike TString,
+         cxxtc::traits::StringLike TView,
+         cxxtc::chrono::internal::FpsFormatFactory TFps,
+         cxxtc::chrono::internal::ArithmeticPolicy TArith>
+struct tuple_element<Index, cxxtc::chrono::internal::__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>>
     : tuple_element<Index,
-                    tuple<typename cxxtc::timecode::__element1_type,
-                          typename cxxtc::timecode::__element2_type,
-                          typename cxxtc::timecode::__element3_type,
-                          typename cxxtc::timecode::__element4_type,
-                          typename cxxtc::timecode::__element5_type,
-                          typename cxxtc::timecode::__element6_type >>
+                    tuple<typename cxxtc::chrono::internal::__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>::__element1_type,
+                          typename cxxtc::chrono::internal::__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>::__element2_type,
+                          typename cxxtc::chrono::internal::__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>::__element3_type,
+                          typename cxxtc::chrono::internal::__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>::__element4_type,
+                          typename cxxtc::chrono::internal::__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>::__element5_type,
+                          typename cxxtc::chrono::internal::__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>::__element6_type >>
 {};
 
+#if defined(__cpp_lib_format)
+// @SECTION: __BasicTimecodeInt std::formatter specialization
+// An empty spec formats like the string conversion. Spec chars, in any order:
+//   s  show subframes, HH:MM:SS:FF.SS
+//   c  separate the frames of drop-frame rates with ':' instead of ';'
+//   f  the total frame count instead of a label
+template<std::integral TInt,
+         std::floating_point TFloat,
+         cxxtc::traits::StringLike TString,
+         cxxtc::traits::StringLike TView,
+         cxxtc::chrono::internal::FpsFormatFactory TFps,
+         cxxtc::chrono::internal::ArithmeticPolicy TArith>
+struct formatter<cxxtc::chrono::internal::__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>, char>
+{
+    bool subframes = false;
+    bool colons_only = false;
+    bool frames_only = false;
+
+    constexpr auto parse(std::format_parse_context& ctx) -> std::format_parse_context::iterator
+    {
+        auto it = ctx.begin();
+        for (; it != ctx.end() && *it != '}'; ++it) {
+            switch (*it) {
+                case 's': this->subframes = true; break;
+                case 'c': this->colons_only = true; break;
+                case 'f': this->frames_only = true; break;
+                default:  throw std::format_error("invalid format spec for a timecode, expected any of 's', 'c' or 'f'");
+            }
+        }
+
+        return it;
+    }
+
+    template<typename TContext>
+    auto format(const cxxtc::chrono::internal::__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>& tc,
+                TContext& ctx) const -> typename TContext::iterator
+    {
+        cxxtc::chrono::internal::__CharsFormat format = tc.chars_format();
+        format.subframes = format.subframes || this->subframes;
+        format.dropframe_separator = !this->colons_only;
+        format.frames_only = this->frames_only;
+
+        // large enough for any label and for a 64-bit frame count
+        char buffer[24];
+        const auto result = tc.to_chars(buffer, buffer + sizeof(buffer), format);
+        return std::copy(buffer, result.ptr, ctx.out());
+    }
+};
+#endif // @END OF __cpp_lib_format
+
 } // @END OF namespace std
 
 ///////////////////////////////////////////////////////////////////////////
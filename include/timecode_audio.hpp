@@ -0,0 +1,205 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Audio sample positions and per-frame sample cadences for timecodes
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Library headers
+#include "timecode_basic.hpp"
+#include "timecode_common.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace cxxtc::chrono::internal {
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Audio Static Config --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#define TCAUDIO_SUBFRAMES_PER_FRAMES 100
+#define TCAUDIO_PULL_NUMERATOR 1000
+#define TCAUDIO_PULL_DENOMINATOR 1001
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Sample Rates
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Exact sample rate in samples per second, the same rational as frame rates so
+// pull-up and pull-down rates stay exact, e.g. 48000 * 1000 / 1001 for 47.952 kHz.
+using __SampleRate = __FPSRational<std::uint64_t>;
+
+struct __SampleRates
+{
+    static constexpr __SampleRate khz_44p1{ 44100, 1 };
+    static constexpr __SampleRate khz_48{ 48000, 1 };
+    static constexpr __SampleRate khz_96{ 96000, 1 };
+    static constexpr __SampleRate khz_192{ 192000, 1 };
+
+    // 0.1% pull-down for film transferred at NTSC rates and pull-up back from it
+    static constexpr __SampleRate khz_44p056{ 44100 * TCAUDIO_PULL_NUMERATOR, TCAUDIO_PULL_DENOMINATOR };
+    static constexpr __SampleRate khz_44p144{ 44100 * TCAUDIO_PULL_DENOMINATOR, TCAUDIO_PULL_NUMERATOR };
+    static constexpr __SampleRate khz_47p952{ 48000 * TCAUDIO_PULL_NUMERATOR, TCAUDIO_PULL_DENOMINATOR };
+    static constexpr __SampleRate khz_48p048{ 48000 * TCAUDIO_PULL_DENOMINATOR, TCAUDIO_PULL_NUMERATOR };
+};
+
+// ticks are subframes, so the tick rate is the frame rate times 100
+template<FpsRational TRational>
+static constexpr auto __tick_rate(const TRational rate) -> __SampleRate
+{
+    return __SampleRate{ static_cast<std::uint64_t>(rate.numerator) * TCAUDIO_SUBFRAMES_PER_FRAMES,
+                         static_cast<std::uint64_t>(rate.denominator) };
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Sample Positions
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Sample positions are ticks moved through the ratio of the tick rate and the
+// sample rate, as in a rate conversion. The ratio is reduced once per rate pair
+// and a conversion is one 128-bit muldiv.
+template<typename TTimecode>
+static constexpr auto __ticks_to_samples(const TTimecode& tc, const __SampleRate sample_rate) -> __RateConversion
+{
+    assert(sample_rate.numerator > 0 && sample_rate.denominator > 0 && "sample rate of a sample conversion must be greater than zero");
+    return __init_rate_conversion(__tick_rate(tc.rate()), sample_rate);
+}
+
+template<typename TTimecode>
+static constexpr auto __samples_to_ticks(const TTimecode& tc, const __SampleRate sample_rate) -> __RateConversion
+{
+    assert(sample_rate.numerator > 0 && sample_rate.denominator > 0 && "sample rate of a sample conversion must be greater than zero");
+    return __init_rate_conversion(sample_rate, __tick_rate(tc.rate()));
+}
+
+// the timecodes of a batch are converted in runs sharing a rate, with the ratio
+// of each run reduced once
+template<typename TTimecode>
+static constexpr void __to_samples_batch(std::span<const TTimecode> timecodes,
+                                         const __SampleRate sample_rate,
+                                         std::span<std::uint64_t> samples,
+                                         const __Rounding rounding)
+{
+    assert(samples.size() >= timecodes.size() && "output span of cxxtc::chrono::internal::__to_samples_batch is too small");
+
+    std::size_t first = 0;
+    while (first < timecodes.size()) {
+        const auto rate = timecodes[first].fps();
+        const __RateConversion conversion = __ticks_to_samples(timecodes[first], sample_rate);
+
+        std::size_t last = first;
+        for (; last < timecodes.size() && timecodes[last].fps() == rate; ++last) {
+            samples[last] = __convert_ticks(std::uint64_t{ timecodes[last].ticks() }, conversion, rounding);
+        }
+
+        first = last;
+    }
+}
+
+template<typename TTimecode>
+static constexpr void __from_samples_batch(std::span<const std::uint64_t> samples,
+                                           const __SampleRate sample_rate,
+                                           const typename TTimecode::fps_scalar_t fps,
+                                           std::span<TTimecode> timecodes,
+                                           const __Rounding rounding)
+{
+    assert(timecodes.size() >= samples.size() && "output span of cxxtc::chrono::internal::__from_samples_batch is too small");
+
+    const TTimecode zero{ 0, fps };
+    const __RateConversion conversion = __samples_to_ticks(zero, sample_rate);
+
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        timecodes[i] = TTimecode{ __convert_ticks(samples[i], conversion, rounding), fps };
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Sample Cadence
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Samples per frame as a reduced ratio: a frame holds numerator / divisor samples
+// and the counts repeat every divisor frames. Frames start at the nearest sample,
+// which gives the SMPTE 272M cadence of 1602, 1601, 1602, 1601, 1602 at 48 kHz and
+// 29.97, and matches sample positions converted with nearest rounding.
+struct __SampleCadence
+{
+    __RateConversion samples_per_frame{};
+
+    // frames in one cycle of the cadence
+    constexpr auto size() const noexcept -> std::uint64_t
+    {
+        return this->samples_per_frame.divisor;
+    }
+
+    // samples in one cycle of the cadence
+    constexpr auto cycle_samples() const noexcept -> std::uint64_t
+    {
+        return this->samples_per_frame.multiplier;
+    }
+
+    // the first sample of a frame
+    constexpr auto frame_start(const std::uint64_t frame) const -> std::uint64_t
+    {
+        return __muldiv_rounded(frame, this->samples_per_frame.multiplier, this->samples_per_frame.divisor, __Rounding::nearest);
+    }
+
+    // the samples in a frame, the same for frames a cycle apart
+    constexpr auto operator[](const std::uint64_t frame) const -> std::uint64_t
+    {
+        const std::uint64_t phase = frame % this->size();
+        return this->frame_start(phase + 1) - this->frame_start(phase);
+    }
+
+    // the counts of consecutive frames from first, e.g. one cycle for a lookup table
+    constexpr void fill(const std::uint64_t first, std::span<std::uint32_t> counts) const
+    {
+        std::uint64_t start = this->frame_start(first);
+        for (std::size_t i = 0; i < counts.size(); ++i) {
+            const std::uint64_t next = this->frame_start(first + i + 1);
+            counts[i] = static_cast<std::uint32_t>(next - start);
+            start = next;
+        }
+    }
+};
+
+template<FpsRational TRational>
+static constexpr auto __init_sample_cadence(const TRational rate, const __SampleRate sample_rate) -> __SampleCadence
+{
+    assert(sample_rate.numerator > 0 && sample_rate.denominator > 0 && "sample rate of a sample cadence must be greater than zero");
+    return __SampleCadence{ __init_rate_conversion(__SampleRate{ rate.numerator, rate.denominator }, sample_rate) };
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+#undef TCAUDIO_SUBFRAMES_PER_FRAMES
+#undef TCAUDIO_PULL_NUMERATOR
+#undef TCAUDIO_PULL_DENOMINATOR
+
+} // @END OF namespace cxxtc::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
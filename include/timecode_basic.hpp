@@ -9,19 +9,23 @@
 
 // Standard headers
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cassert>
 #include <compare>
 #include <cstring>
 #include <cstdlib>
 #include <cctype>
+#include <charconv>
 #include <cmath>
 #include <concepts>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
 #include <limits>
+#include <numeric>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <utility>
 
@@ -69,7 +73,7 @@ namespace cxxtc::chrono::internal {
 #define TCSCALAR_HRS_MAX 60
 #define TCSCALAR_MINS_MAX 60
 #define TCSCALAR_SECS_MAX 60
-#define TCSCALAR_FRAMES_MAX 60
+#define TCSCALAR_FRAMES_MAX 100
 #define TCSCALAR_SUBFRAMES_MAX 100
 #define TCSCALAR_HRS_START 0
 #define TCSCALAR_MINS_START 1
@@ -84,6 +88,36 @@ namespace cxxtc::chrono::internal {
 #define TCSCALAR_MINS_TICKS 60
 #define TCSCALAR_SECS_TICKS 1
 
+#define TCSCALAR_DROPFRAME_DIVISOR 15
+#define TCSCALAR_DROPFRAME_MINS_CYCLE 10
+
+#define TCSCALAR_DAY_HRS 24
+
+#define TCSTORAGE_FPS_BITS 8
+#define TCSTORAGE_FLAGS_BITS 8
+#define TCSTORAGE_TICKS_BITS 48
+
+// byte masks of a label read as two little-endian words: the first holds chars
+// 0-7, the second chars 8-15 with the missing subframes padded as ".00"
+#define TCSWAR_DIGITS_LOW 0xffff'00ff'ff00'ffffull
+#define TCSWAR_COLONS_LOW 0x0000'ff00'00ff'0000ull
+#define TCSWAR_EXPECTED_LOW 0x0000'3a00'003a'0000ull
+#define TCSWAR_DIGITS_HIGH 0x0000'ffff'00ff'ff00ull
+#define TCSWAR_COLONS_HIGH 0x0000'0000'ff00'00feull // ':' and ';' only differ in the low bit
+#define TCSWAR_EXPECTED_HIGH 0x0000'0000'2e00'003aull
+#define TCSWAR_PADDING_STANDARD 0x3030'3030'2e00'0000ull
+#define TCSWAR_PADDING_WITH_SUBFRAMES 0x3030'0000'0000'0000ull
+#define TCSWAR_ZEROS 0x3030'3030'3030'3030ull
+#define TCSWAR_HIGH_NIBBLES 0xf0f0'f0f0'f0f0'f0f0ull
+#define TCSWAR_DIGIT_CARRY 0x0606'0606'0606'0606ull
+
+// MSVC only collapses the first empty base unless asked to lay out all of them
+#if defined(_MSC_VER)
+#define TC_EMPTY_BASES __declspec(empty_bases)
+#else
+#define TC_EMPTY_BASES
+#endif
+
 #define TCSCALAR_1HR_IN_SUBFRAMES (TCSCALAR_HRS_TICKS * TCSCALAR_SUBFRAMES_PER_FRAMES)
 #define TCSCALAR_1MIN_IN_SUBFRAMES (TCSCALAR_MINS_TICKS * TCSCALAR_SUBFRAMES_PER_FRAMES)
 #define TCSCALAR_1SEC_IN_SUBFRAMES (TCSCALAR_SECS_TICKS * TCSCALAR_SUBFRAMES_PER_FRAMES)
@@ -126,12 +160,6 @@ namespace cxxtc::chrono::internal {
 #define GET_TCGRP_STRING_MAPPING(inner) GET_TCGRP_AT(TCGRP_STRING_MAPPING, inner)
 #define CALL_TCGRP_STRING_MAPPING(inner, ...) GET_TCGRP_STRING_MAPPING(inner)(__VA_ARGS__)
 
-// TODO: Make this accept variable size
-#define UNWRAP_TCVALUES(p, m, n) p.m[0], p.m[1], p.m[2], p.m[3], p.m[4]
-
-// TODO: Make this accept variable size
-#define TCVALUES_DEFAULT_INITIALIZER { 0, 0, 0, 0, 0 }
-
 // TODO: Make this accept variable size
 #define TCSTRING_DEFAULT_INITIALIZER {      \
         '0', '0', TCSTRING_COLON_DEFAULT,   \
@@ -197,6 +225,259 @@ static constexpr auto __init_tick_groups(std::tuple<Ts...> is, std::index_sequen
     };
 }
 
+// SMPTE ST 12-1 drop-frame counting: the first frame labels of every minute are
+// skipped, except for every tenth minute. Frames dropped per minute are the timebase
+// divided by 15 (2 at 30 fps, 4 at 60 fps). Both conversions are closed-form so
+// they cost the same for any position in the day. The divide_* callables let run-time
+// rates divide through precomputed reciprocals instead of a hardware divide.
+template<std::unsigned_integral T, typename TDivideCycle, typename TDivideMinute>
+static constexpr auto __dropframe_to_label(const T frames, const T timebase,
+                                           TDivideCycle divide_by_cycle, TDivideMinute divide_by_minute) -> T
+{
+    const T dropped = timebase / TCSCALAR_DROPFRAME_DIVISOR;
+    const T frames_per_minute = (timebase * TCSCALAR_MINS_TICKS) - dropped;
+    const T frames_per_cycle = (frames_per_minute * TCSCALAR_DROPFRAME_MINS_CYCLE) + dropped;
+
+    const T cycles = divide_by_cycle(frames);
+    const T remainder = frames - (cycles * frames_per_cycle);
+
+    return frames
+         + (dropped * (TCSCALAR_DROPFRAME_MINS_CYCLE - 1) * cycles)
+         + (dropped * divide_by_minute(std::max(remainder, dropped) - dropped));
+}
+
+template<std::unsigned_integral T>
+static constexpr auto __dropframe_to_label(const T frames, const T timebase) -> T
+{
+    const T dropped = timebase / TCSCALAR_DROPFRAME_DIVISOR;
+    const T frames_per_minute = (timebase * TCSCALAR_MINS_TICKS) - dropped;
+    const T frames_per_cycle = (frames_per_minute * TCSCALAR_DROPFRAME_MINS_CYCLE) + dropped;
+
+    return __dropframe_to_label(frames, timebase,
+                                [=](const T n) constexpr -> T { return n / frames_per_cycle; },
+                                [=](const T n) constexpr -> T { return n / frames_per_minute; });
+}
+
+// total_minutes is the label divided by the frames in a nominal (undropped) minute
+template<std::unsigned_integral T>
+static constexpr auto __dropframe_from_label(const T label, const T timebase, const T total_minutes) -> T
+{
+    const T dropped = timebase / TCSCALAR_DROPFRAME_DIVISOR;
+    return label - (dropped * (total_minutes - (total_minutes / TCSCALAR_DROPFRAME_MINS_CYCLE)));
+}
+
+template<std::unsigned_integral T>
+static constexpr auto __dropframe_from_label(const T label, const T timebase) -> T
+{
+    return __dropframe_from_label(label, timebase, label / (timebase * TCSCALAR_MINS_TICKS));
+}
+
+// ticks in a 24-hour timecode day; drop-frame rates count only the labels they keep
+template<std::unsigned_integral T>
+static constexpr auto __ticks_per_day(const T timebase, const bool drop_frame) -> T
+{
+    const T labels = TCSCALAR_DAY_HRS * TCSCALAR_HRS_TICKS * timebase;
+    return ((drop_frame) ? __dropframe_from_label(labels, timebase) : labels) * TCSCALAR_SUBFRAMES_PER_FRAMES;
+}
+
+// Reciprocals for every divisor a rate needs at run time. The tick factors of a rate
+// never change, so they are computed once per fps format at compile time and looked
+// up by format instead of dividing by a value the compiler cannot see.
+struct __RateDivisors
+{
+    std::array<cxxtc::utility::fast_divisor, TC_TOTAL_GROUPS> tick_factors;
+    cxxtc::utility::fast_divisor dropframe_cycle;
+    cxxtc::utility::fast_divisor dropframe_minute;
+    cxxtc::utility::fast_divisor day;
+};
+
+template<typename TGroups, std::size_t... Is>
+static constexpr auto __init_rate_divisors(const TGroups& groups,
+                                           const std::uint64_t timebase,
+                                           const bool drop_frame,
+                                           std::index_sequence<Is...> seq) -> __RateDivisors
+{
+    static_assert(sizeof...(Is) == TC_TOTAL_GROUPS,
+                  "index sequence of local input variable \"seq\" must have exactly "
+                  "TC_TOTAL_GROUPS indexes to build the table of tick divisors");
+
+    // formats without a timebase (e.g. none) get a harmless divisor of one
+    const auto divisor = [](const std::uint64_t d) constexpr {
+        return cxxtc::utility::fast_divisor(std::max<std::uint64_t>(d, 1));
+    };
+
+    const std::uint64_t dropped = timebase / TCSCALAR_DROPFRAME_DIVISOR;
+    const std::uint64_t frames_per_minute = (timebase * TCSCALAR_MINS_TICKS) - dropped;
+    const std::uint64_t frames_per_cycle = (frames_per_minute * TCSCALAR_DROPFRAME_MINS_CYCLE) + dropped;
+
+    return __RateDivisors {
+        { divisor(std::get<TCGRP_SCALAR_VALUE_MAPPING>(std::get<Is>(groups))(timebase)) ... },
+        divisor(frames_per_cycle),
+        divisor(frames_per_minute),
+        divisor(__ticks_per_day(timebase, drop_frame))
+    };
+}
+
+template<FpsFormatFactory TFps, typename TGroups, std::size_t... Is>
+static constexpr auto __init_rate_divisor_table(const TGroups& groups, std::index_sequence<Is...> seq)
+{
+    constexpr auto formats = magic_enum::enum_values<typename TFps::type>();
+    static_assert(((static_cast<std::size_t>(formats[Is]) == Is) && ...),
+                  "values of the fps format must be contiguous from zero to index the table of tick divisors");
+
+    return std::array<__RateDivisors, sizeof...(Is)> {
+        __init_rate_divisors(groups,
+                             static_cast<std::uint64_t>(TFps::to_timebase(formats[Is])),
+                             TFps::is_drop_frame(formats[Is]),
+                             std::make_index_sequence<TC_TOTAL_GROUPS>{}) ...
+    };
+}
+
+// Not constexpr on purpose: reaching it while building a timecode literal stops the
+// compile, and the message shows up in the diagnostic.
+inline void __invalid_timecode_literal(const char*) {}
+
+// Ticks at one rate become ticks at another by multiplying with the ratio of the
+// two exact rates. The ratio is kept reduced, so ticks * multiplier and ticks *
+// divisor count the same instant in the largest unit both rates divide evenly
+// (the LCM of the two tick rates). 25 -> 30 is 6 / 5, 29.97 -> 25 is 1001 / 1200.
+struct __RateConversion
+{
+    std::uint64_t multiplier = 1;
+    std::uint64_t divisor = 1;
+};
+
+template<FpsRational TRational>
+static constexpr auto __init_rate_conversion(const TRational from, const TRational to) -> __RateConversion
+{
+    // formats without a rate (e.g. none) convert one to one
+    if (from.numerator == 0 || to.numerator == 0) return __RateConversion{};
+
+    const std::uint64_t multiplier = static_cast<std::uint64_t>(to.numerator) * from.denominator;
+    const std::uint64_t divisor = static_cast<std::uint64_t>(from.numerator) * to.denominator;
+    const std::uint64_t gcd = std::gcd(multiplier, divisor);
+
+    return __RateConversion{ multiplier / gcd, divisor / gcd };
+}
+
+template<FpsFormatFactory TFps, std::size_t... Is>
+static constexpr auto __init_rate_conversion_table(std::index_sequence<Is...> seq)
+{
+    constexpr auto formats = magic_enum::enum_values<typename TFps::type>();
+    constexpr std::size_t total_formats = sizeof...(Is);
+
+    std::array<std::array<__RateConversion, total_formats>, total_formats> table{};
+    for (std::size_t from = 0; from < total_formats; ++from) {
+        table[from] = std::array<__RateConversion, total_formats> {
+            __init_rate_conversion(TFps::to_rational(formats[from]), TFps::to_rational(formats[Is])) ...
+        };
+    }
+
+    return table;
+}
+
+// value * multiplier / divisor in integer math, rounded when the result falls
+// between two units. The remainder is exact in wrapping arithmetic as it is
+// smaller than the divisor.
+static constexpr auto __muldiv_rounded(const std::uint64_t value,
+                                       const std::uint64_t multiplier,
+                                       const std::uint64_t divisor,
+                                       const __Rounding rounding) -> std::uint64_t
+{
+    const std::uint64_t quotient = cxxtc::utility::internal::muldiv(value, multiplier, divisor);
+    const std::uint64_t remainder = (value * multiplier) - (quotient * divisor);
+
+    switch (rounding) {
+        case __Rounding::down:    return quotient;
+        case __Rounding::up:      return quotient + (remainder != 0);
+        case __Rounding::nearest: break;
+    }
+
+    return quotient + (remainder >= divisor - remainder);
+}
+
+// moves a tick count through a rate conversion, rounding when the instant falls
+// between two ticks of the target rate
+template<std::unsigned_integral T>
+static constexpr auto __convert_ticks(const T ticks, const __RateConversion& conversion, const __Rounding rounding) -> T
+{
+    return static_cast<T>(__muldiv_rounded(ticks, conversion.multiplier, conversion.divisor, rounding));
+}
+
+// eight chars as a word with the first char in the low byte on any target
+static inline auto __swar_load(const char* chars) -> std::uint64_t
+{
+    std::uint64_t word = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(&word, chars, sizeof(word));
+    }
+
+    else {
+        for (std::size_t i = 0; i < sizeof(word); ++i) {
+            word |= std::uint64_t{ static_cast<unsigned char>(chars[i]) } << (i * 8);
+        }
+    }
+
+    return word;
+}
+
+// true when every byte selected by mask is an ASCII digit: the high nibble is 3 and
+// stays 3 after adding 6, a carry out of a byte only happens when it already failed
+static constexpr auto __swar_all_digits(const std::uint64_t word, const std::uint64_t mask) -> bool
+{
+    const std::uint64_t selected = word & mask;
+    return (selected & (TCSWAR_HIGH_NIBBLES & mask)) == (TCSWAR_ZEROS & mask)
+        && ((selected + (TCSWAR_DIGIT_CARRY & mask)) & (TCSWAR_HIGH_NIBBLES & mask)) == (TCSWAR_ZEROS & mask);
+}
+
+// Validates and parses an HH:MM:SS:FF or HH:MM:SS:FF.SS label in one pass over
+// two 64-bit words. Each word is checked for digits and separators with a few
+// masks, then every digit pair is combined at once as tens * 10 + ones. Reads
+// exactly length chars and writes zero groups for a malformed label.
+template<std::unsigned_integral T>
+static inline auto __swar_parse_label(const char* tc, const std::size_t length, std::array<T, TC_TOTAL_GROUPS>& groups) -> bool
+{
+    groups = {};
+    if (length != TCSTRING_SIZE_STANDARD && length != TCSTRING_SIZE_WITH_SUBFRAMES) return false;
+
+    // two overlapping loads cover both lengths without reading past the label
+    const std::uint64_t low = __swar_load(tc);
+    const std::uint64_t tail = __swar_load(tc + length - sizeof(std::uint64_t));
+
+    const std::uint64_t high = (length == TCSTRING_SIZE_WITH_SUBFRAMES)
+                             ? (tail >> 16) | TCSWAR_PADDING_WITH_SUBFRAMES
+                             : (tail >> 40) | TCSWAR_PADDING_STANDARD;
+
+    const bool valid = __swar_all_digits(low, TCSWAR_DIGITS_LOW)
+                    && __swar_all_digits(high, TCSWAR_DIGITS_HIGH)
+                    && ((low ^ TCSWAR_EXPECTED_LOW) & TCSWAR_COLONS_LOW) == 0
+                    && ((high ^ TCSWAR_EXPECTED_HIGH) & TCSWAR_COLONS_HIGH) == 0;
+
+    if (!valid) return false;
+
+    // each tens byte becomes tens * 10 + ones, no byte exceeds 99 so nothing carries
+    const std::uint64_t low_digits = (low & TCSWAR_DIGITS_LOW) - (TCSWAR_ZEROS & TCSWAR_DIGITS_LOW);
+    const std::uint64_t high_digits = (high & TCSWAR_DIGITS_HIGH) - (TCSWAR_ZEROS & TCSWAR_DIGITS_HIGH);
+    const std::uint64_t low_pairs = (low_digits * 10) + (low_digits >> 8);
+    const std::uint64_t high_pairs = (high_digits * 10) + (high_digits >> 8);
+
+    groups[TCSCALAR_HRS_START] = static_cast<T>(low_pairs & 0xff);
+    groups[TCSCALAR_MINS_START] = static_cast<T>((low_pairs >> 24) & 0xff);
+    groups[TCSCALAR_SECS_START] = static_cast<T>((low_pairs >> 48) & 0xff);
+    groups[TCSCALAR_FRAMES_START] = static_cast<T>((high_pairs >> 8) & 0xff);
+    groups[TCSCALAR_SUBFRAMES_START] = static_cast<T>((high_pairs >> 32) & 0xff);
+
+    return true;
+}
+
+// how to_chars and std::format write a timecode
+struct __CharsFormat
+{
+    bool subframes = false;          // HH:MM:SS:FF.SS instead of HH:MM:SS:FF
+    bool dropframe_separator = true; // ';' before the frames of drop-frame rates
+    bool frames_only = false;        // the total frame count instead of a label
+};
+
 ///////////////////////////////////////////////////////////////////////////
 
 
@@ -207,13 +488,14 @@ static constexpr auto __init_tick_groups(std::tuple<Ts...> is, std::index_sequen
 ///////////////////////////////////////////////////////////////////////////
 
 // TODO: concept & type trait to get unsigned and signed types
-#define __TEMPLATE_TYPE __BasicTimecodeInt<TInt, TFloat, TString, TView, TFps>
+#define __TEMPLATE_TYPE __BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>
 template<std::integral TInt,
          std::floating_point TFloat,
          cxxtc::traits::StringLike TString,
          cxxtc::traits::StringLike TView,
-         FpsFormatFactory TFps>
-class __BasicTimecodeInt : public cxxtc::traits::__implicit_string_overload_crtp<__TEMPLATE_TYPE, TString>
+         FpsFormatFactory TFps,
+         ArithmeticPolicy TArith = __ArithmeticUnchecked>
+class TC_EMPTY_BASES __BasicTimecodeInt : public cxxtc::traits::__implicit_string_overload_crtp<__TEMPLATE_TYPE, TString>
                          , public cxxtc::traits::__convert_to_signed<__TEMPLATE_TYPE, cxxtc::traits::to_signed_t<TInt>>
                          , public cxxtc::traits::__convert_to_unsigned<__TEMPLATE_TYPE, cxxtc::traits::to_unsigned_t<TInt>>
                          , public cxxtc::traits::__convert_to_float<__TEMPLATE_TYPE, TFloat>
@@ -238,11 +520,15 @@ public:
     using float_type       = typename cxxtc::traits::__convert_to_float<__my_type, TFloat>::float_type;
     using string_type      = typename cxxtc::traits::__convert_to_string<__my_type, string_t>::string_type;
     using char_t           = cxxtc::traits::string_char_type_t<string_t>;
+    using static_string_t  = cxxtc::utility::static_string<TCSTRING_SIZE_WITH_SUBFRAMES + 1, char_t>;
     using display_t        = string_view_t;
     using fps_t            = TFps;
     using fps_scalar_t     = typename TFps::type;
+    using arithmetic_t     = TArith;
     using flags_t          = std::uint8_t;
+    using storage_t        = std::uint64_t;
     using scalar_t         = std::uint8_t;
+    using groups_t         = std::array<unsigned_type, TC_TOTAL_GROUPS>;
 
     // internal tuple aliases
     using __element1_type = unsigned_type;
@@ -262,6 +548,9 @@ public:
 ///////////////////////////////////////////////////////////////////////////
 
 private:
+    static constexpr bool __is_constant_fps = ConstantFpsFormat<TFps>;
+    static constexpr bool __has_swar_parser = std::is_same_v<char_t, char>;
+
     static constexpr std::tuple __tick_groups = __init_tick_groups(
         std::tuple{
             std::array { TCSCALAR_HRS_START,       0, TCSCALAR_HRS_MAX,       TCSCALAR_1HR_IN_SUBFRAMES,  TCSTRING_HRS_START       },
@@ -273,6 +562,15 @@ private:
         std::make_index_sequence<TC_TOTAL_GROUPS>{}
     );
 
+    static constexpr auto __rate_divisors = __init_rate_divisor_table<TFps>(
+        __tick_groups,
+        std::make_index_sequence<magic_enum::enum_count<fps_scalar_t>()>{}
+    );
+
+    static constexpr auto __rate_conversions = __init_rate_conversion_table<TFps>(
+        std::make_index_sequence<magic_enum::enum_count<fps_scalar_t>()>{}
+    );
+
 ///////////////////////////////////////////////////////////////////////////
 
 
@@ -283,12 +581,23 @@ private:
 ///////////////////////////////////////////////////////////////////////////
 
 private:
-    template<std::size_t N>
-    static constexpr auto __set_values_default(scalar_t(&values)[N])
+    template<std::size_t... Is>
+    static constexpr auto __tick_factors(const unsigned_type fps_factor, std::index_sequence<Is...> seq) -> groups_t
     {
-        for (std::size_t i = 0; i < N; ++i) {
-            values[i] = 0;
+        static_assert(sizeof...(Is) == TC_TOTAL_GROUPS,
+                      "index sequence of local input variable \"seq\" must have exactly "
+                      "TC_TOTAL_GROUPS indexes to build the table of tick factors");
+
+        return groups_t{ static_cast<unsigned_type>(CALL_TCGRP_SCALAR_VALUE_MAPPING(Is, fps_factor)) ... };
+    }
+
+    static constexpr auto __init_fps(const fps_scalar_t fps) -> storage_t
+    {
+        if constexpr (__is_constant_fps) {
+            assert(fps == fps_t::value && "fps passed to a timecode with a compile-time rate must match that rate");
         }
+
+        return static_cast<storage_t>(fps);
     }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -314,62 +623,163 @@ friend std::ostream& operator<<(std::ostream& out, const __my_type& tc)
     return out;
 }
 
-///////////////////////////////////////////////////////////////////////////
+// Reads a label at the rate of tc straight from the streambuf, without a temporary
+// string: leading whitespace is skipped, then each char is checked as it is read
+// and extraction stops at the first one that can't continue the label. Sets
+// failbit for malformed or out of range labels and leaves tc unchanged.
+friend std::istream& operator>>(std::istream& in, __my_type& tc)
+{
+    const std::istream::sentry sentry(in);
+    if (!sentry) return in;
 
+    using traits_t = std::istream::traits_type;
+    std::streambuf* buffer = in.rdbuf();
+    std::ios_base::iostate state = std::ios_base::goodbit;
 
-///////////////////////////////////////////////////////////////////////////
-//
-//  -- @SECTION Ctors, Dtors & Assignment --
-//
-///////////////////////////////////////////////////////////////////////////
+    char label[TCSTRING_SIZE_WITH_SUBFRAMES];
+    std::size_t length = 0;
 
-public:
-    constexpr __BasicTimecodeInt() = default;
-    constexpr ~__BasicTimecodeInt() = default;
+    const auto read_until = [&](const std::size_t end) {
+        for (auto c = buffer->sgetc(); length < end; c = buffer->snextc()) {
+            if (traits_t::eq_int_type(c, traits_t::eof())) {
+                state |= std::ios_base::eofbit;
+                return;
+            }
 
-    constexpr __BasicTimecodeInt(const __BasicTimecodeInt& tc)
-        : _fps(tc._fps)
-        , _flags(tc._flags)
-        , _values{UNWRAP_TCVALUES(tc, _values, TC_TOTAL_GROUPS)}
-    {}
+            if (!__is_label_char(length, traits_t::to_char_type(c))) return;
+            label[length++] = traits_t::to_char_type(c);
+        }
+    };
 
-    constexpr __BasicTimecodeInt(__BasicTimecodeInt&& tc) noexcept
-        : _fps(tc._fps)
-        , _flags(tc._flags)
-        , _values{UNWRAP_TCVALUES(tc, _values, TC_TOTAL_GROUPS)}
+    // subframes are read when a '.' follows the frames, eofbit is set when the
+    // stream ends right after the label like the arithmetic extractors do
+    read_until(TCSTRING_SIZE_STANDARD);
+    if (length == TCSTRING_SIZE_STANDARD
+        && traits_t::eq_int_type(buffer->sgetc(), traits_t::to_int_type(TCSTRING_COLON_SUBFRAMES))) {
+        read_until(TCSTRING_SIZE_WITH_SUBFRAMES);
+    }
+
+    if (length == TCSTRING_SIZE_WITH_SUBFRAMES || length == TCSTRING_SIZE_STANDARD) {
+        if (traits_t::eq_int_type(buffer->sgetc(), traits_t::eof())) state |= std::ios_base::eofbit;
+    }
+
+    groups_t groups;
+    if ((length == TCSTRING_SIZE_STANDARD || length == TCSTRING_SIZE_WITH_SUBFRAMES)
+        && __swar_parse_label(label, length, groups) && __is_valid_label(groups, tc.fps())) {
+        tc._ticks = tc.join_groups(groups);
+    }
+
+    else {
+        state |= std::ios_base::failbit;
+    }
+
+    in.setstate(state);
+    return in;
+}
+
+// digits at every position of a label but the separators after each group
+static constexpr bool __is_label_char(const std::size_t index, const char c)
+{
+    switch (index) {
+        case TCSTRING_MINS_START - 1:
+        case TCSTRING_SECS_START - 1:      return c == TCSTRING_COLON_DEFAULT;
+        case TCSTRING_FRAMES_START - 1:    return c == TCSTRING_COLON_DEFAULT || c == TCSTRING_COLON_DROPFRAME;
+        case TCSTRING_SUBFRAMES_START - 1: return c == TCSTRING_COLON_SUBFRAMES;
+        default:                           return c >= TCSTRING_CHAR_OFFSET && c <= TCSTRING_CHAR_OFFSET + 9;
+    }
+}
+
+public:
+    // the format of the string conversion: subframes when the extended string is
+    // enabled, ';' before the frames of drop-frame rates
+    constexpr auto chars_format() const noexcept -> __CharsFormat
     {
-        tc._fps = fps_t::default_value();
-        tc._flags = {};
-        __set_values_default(tc._values);
+        return __CharsFormat{ this->is_flag_set<TCFLAGS_SHOW_WITH_SUBFRAMES>(), true, false };
     }
 
-    constexpr __BasicTimecodeInt& operator=(const __BasicTimecodeInt& tc)
+    // Writes the timecode into [first, last) like std::to_chars, without allocating:
+    // ptr is one past the last char written, or last with value_too_large when the
+    // timecode doesn't fit. Hours wrap at 100 like the string conversion.
+    auto to_chars(char* first, char* last, const __CharsFormat format) const -> std::to_chars_result
+        requires std::is_same_v<char_t, char>
     {
-        this->_fps = tc._fps;
-        this->_flags = tc._flags;
-        this->set_values(tc._values);
-        return *this;
+        if (format.frames_only) {
+            return std::to_chars(first, last, static_cast<unsigned_type>(this->_ticks) / TCSCALAR_SUBFRAMES_PER_FRAMES);
+        }
+
+        const std::size_t length = (format.subframes) ? TCSTRING_SIZE_WITH_SUBFRAMES : TCSTRING_SIZE_STANDARD;
+        if (static_cast<std::size_t>(last - first) < length) return { last, std::errc::value_too_large };
+
+        const groups_t groups = this->split_ticks();
+        for (std::size_t i = 0; i * (TC_GROUP_WIDTH + 1) < length; ++i) {
+            const unsigned_type value = groups[i] % 100;
+            first[i * (TC_GROUP_WIDTH + 1)] = static_cast<char>(TCSTRING_CHAR_OFFSET + (value / 10));
+            first[(i * (TC_GROUP_WIDTH + 1)) + 1] = static_cast<char>(TCSTRING_CHAR_OFFSET + (value % 10));
+        }
+
+        first[TCSTRING_MINS_START - 1] = TCSTRING_COLON_DEFAULT;
+        first[TCSTRING_SECS_START - 1] = TCSTRING_COLON_DEFAULT;
+        first[TCSTRING_FRAMES_START - 1] = (format.dropframe_separator && this->is_drop_frame())
+                                         ? TCSTRING_COLON_DROPFRAME
+                                         : TCSTRING_COLON_DEFAULT;
+
+        if (format.subframes) first[TCSTRING_SUBFRAMES_START - 1] = TCSTRING_COLON_SUBFRAMES;
+
+        return { first + length, std::errc{} };
     }
 
-    constexpr __BasicTimecodeInt& operator=(__BasicTimecodeInt&& tc) noexcept
+    auto to_chars(char* first, char* last) const -> std::to_chars_result
+        requires std::is_same_v<char_t, char>
     {
-        this->_fps = tc._fps;
-        this->_flags = tc._flags;
-        this->set_values(tc._values);
+        return this->to_chars(first, last, this->chars_format());
+    }
 
-        tc._fps = fps_t::default_value();
-        tc._flags = TCFLAGS_DEFAULT;
-        __set_values_default(tc._values);
+    // Reads the longest label at the start of [first, last) at the rate of tc, like
+    // std::from_chars: invalid_argument when no label starts there, result_out_of_range
+    // when its groups are out of range for the rate. tc is only changed on success.
+    static auto from_chars(const char* first, const char* last, __my_type& tc) -> std::from_chars_result
+        requires std::is_same_v<char_t, char>
+    {
+        const auto available = static_cast<std::size_t>(last - first);
+        for (const std::size_t length : { TCSTRING_SIZE_WITH_SUBFRAMES, TCSTRING_SIZE_STANDARD }) {
+            groups_t groups;
+            if (available < length || !__swar_parse_label(first, length, groups)) continue;
 
-        return *this;
+            if (!__is_valid_label(groups, tc.fps())) return { first + length, std::errc::result_out_of_range };
+
+            tc._ticks = tc.join_groups(groups);
+            return { first + length, std::errc{} };
+        }
+
+        return { first, std::errc::invalid_argument };
     }
 
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Ctors, Dtors & Assignment --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    constexpr __BasicTimecodeInt() = default;
+    constexpr ~__BasicTimecodeInt() = default;
+
+    // copies and moves are plain copies of the packed word, so containers of
+    // timecodes can relocate them with memcpy
+    constexpr __BasicTimecodeInt(const __BasicTimecodeInt&) = default;
+    constexpr __BasicTimecodeInt(__BasicTimecodeInt&&) noexcept = default;
+    constexpr __BasicTimecodeInt& operator=(const __BasicTimecodeInt&) = default;
+    constexpr __BasicTimecodeInt& operator=(__BasicTimecodeInt&&) noexcept = default;
+
     template<std::integral T>
     constexpr __BasicTimecodeInt(const T ticks,
                                  const fps_scalar_t fps = fps_t::default_value()) noexcept
-        : _fps(fps)
+        : _fps(__init_fps(fps))
         , _flags(TCFLAGS_DEFAULT)
-        , _values{}
+        , _ticks(0)
     {
         this->set_ticks(ticks);
     }
@@ -379,73 +789,100 @@ public:
               || std::is_same_v<TChar*, const char_t*>
     constexpr __BasicTimecodeInt(TChar* tc,
                                  const fps_scalar_t fps = fps_t::default_value())
-        : _fps(fps)
+        : __BasicTimecodeInt(string_view_t{ tc }, fps)
+    {}
+
+    constexpr __BasicTimecodeInt(string_view_t tc,
+                                 const fps_scalar_t fps = fps_t::default_value())
+        : _fps(__init_fps(fps))
         , _flags(TCFLAGS_DEFAULT)
-        , _values{}
-    {
-        // validate tc_string
-        // TODO: Better default behaviour for invalid tc strings
-        assert(this->is_valid_tc_string(tc) && "timecode passed to constructor has an invalid format");
-
-        // transfer tc_string data
-        scalar_t current = 0;
-        std::size_t group_index = 0;
-        std::size_t values_index = 0;
-        std::size_t decimal_pos = TC_GROUP_WIDTH - 1;
-
-        char_t c = *tc;
-        for (std::ptrdiff_t i = 1; c != '\0'; ++i) {
-            if (group_index++ < TC_GROUP_WIDTH) {
-                current += (c - TCSTRING_CHAR_OFFSET) * (std::pow(10, decimal_pos--)); // TODO: Roll your own integral pow function to avoid conversion
-            }
+        , _ticks(0)
+    {
+        // a malformed label reads as zero and sets the error flag, parse() reports why
+        groups_t groups;
+        const bool valid = __parse_label(tc, groups);
+        assert(valid && "timecode passed to string constructor has an invalid format");
 
-            else {
-                this->_values[values_index++] = current;
-                current = 0;
-                group_index = 0;
-                decimal_pos = TC_GROUP_WIDTH - 1;
-            }
+        this->_ticks = this->join_groups(groups);
+        if (!valid) this->_flags |= TCFLAGS_ERROR;
+    }
 
-            c = *(tc + i);
+    // builds a timecode from a string literal during compilation, see the literals in
+    // cxxtc::literals; a malformed or out of range label fails the build
+    static consteval auto __from_literal(const char_t* tc, const std::size_t length, const fps_scalar_t fps) -> __my_type
+    {
+        const string_view_t view{ tc, length };
+        if (!__is_valid_tc_string(view)) {
+            __invalid_timecode_literal("timecode literal must be formatted as HH:MM:SS:FF or HH:MM:SS:FF.SS");
+        }
+
+        else if (!fps_t::is_drop_frame(fps) && view[TCSTRING_FRAMES_START - 1] == TCSTRING_COLON_DROPFRAME) {
+            __invalid_timecode_literal("only drop-frame timecode literals separate frames with ';'");
         }
 
-        this->_values[values_index] = current;
+        else if (!__is_valid_label(__parse_tc_string(view), fps)) {
+            __invalid_timecode_literal("timecode literal is out of range for its fps");
+        }
+
+        return __my_type{ view, fps };
     }
 
-    constexpr __BasicTimecodeInt(string_view_t tc,
-                                 const fps_scalar_t fps = fps_t::default_value())
-        : _fps(fps)
-        , _flags(TCFLAGS_DEFAULT)
-        , _values{}
+    // Parses a label and checks it against its rate without asserting or throwing:
+    // the format, the group limits of the rate and the labels drop-frame counting
+    // skips. Rejecting input costs no more than accepting it.
+    static constexpr auto parse(const string_view_t tc, const fps_scalar_t fps = fps_t::default_value()) noexcept
+        -> cxxtc::utility::expected<__my_type, __ParseError>
     {
-        // validate tc_string
-        // TODO: Better default behaviour for invalid tc strings
-        assert(this->is_valid_tc_string(tc) && "timecode passed to string constructor has an invalid format");
+        using failure = cxxtc::utility::unexpected<__ParseError>;
 
-        // transfer tc_string data
-        scalar_t current = 0;
-        std::size_t group_index = 0;
-        std::size_t values_index = 0;
-        std::size_t decimal_pos = TC_GROUP_WIDTH - 1;
+        if (tc.length() != TCSTRING_SIZE_STANDARD && tc.length() != TCSTRING_SIZE_WITH_SUBFRAMES) {
+            return failure{ __ParseError::invalid_length };
+        }
 
-        for (auto c : tc) {
-            if (group_index++ < TC_GROUP_WIDTH) {
-                current += (c - TCSTRING_CHAR_OFFSET) * (std::pow(10, decimal_pos--)); // TODO: Roll your own integral pow function to avoid conversion
-            }
+        groups_t groups;
+        if (!__parse_label(tc, groups)) return failure{ __ParseError::invalid_format };
+        return from_groups(groups, fps);
+    }
 
-            else {
-                this->_values[values_index++] = current;
-                current = 0;
-                group_index = 0;
-                decimal_pos = TC_GROUP_WIDTH - 1;
-            }
-        }
+    // Builds a timecode from label groups {hours, minutes, seconds, frames, subframes}
+    // checked like parse(), e.g. groups decoded from a binary codeword
+    static constexpr auto from_groups(const groups_t& groups, const fps_scalar_t fps = fps_t::default_value()) noexcept
+        -> cxxtc::utility::expected<__my_type, __ParseError>
+    {
+        using failure = cxxtc::utility::unexpected<__ParseError>;
+
+        if (!__is_label_in_range(groups, fps)) return failure{ __ParseError::out_of_range };
+        if (__is_skipped_label(groups, fps)) return failure{ __ParseError::skipped_label };
+
+        __my_type result{ 0, fps };
+        result._ticks = result.join_groups(groups);
+        return result;
+    }
+
+    // the label groups {hours, minutes, seconds, frames, subframes} in one split
+    constexpr auto label_groups() const -> groups_t
+    {
+        return this->split_ticks();
+    }
 
-        this->_values[values_index] = current;
+    // converts between runtime and compile-time rate variants of the same timecode,
+    // the timecode label is preserved when the rates differ
+    template<FpsFormatFactory UFps, ArithmeticPolicy UArith>
+        requires (!std::is_same_v<UFps, TFps> || !std::is_same_v<UArith, TArith>)
+              && std::is_same_v<typename UFps::type, fps_scalar_t>
+    explicit constexpr __BasicTimecodeInt(const __BasicTimecodeInt<TInt, TFloat, TString, TView, UFps, UArith>& tc)
+        : _fps(__init_fps((__is_constant_fps) ? fps_t::default_value() : tc.fps()))
+        , _flags(tc._flags)
+        , _ticks(tc._ticks)
+    {
+        if (tc.fps() != this->fps()) this->_ticks = this->join_groups(tc.split_ticks());
     }
 
 private:
-    inline bool is_valid_tc_string(const string_view_t tc)
+    template<std::integral, std::floating_point, cxxtc::traits::StringLike, cxxtc::traits::StringLike, FpsFormatFactory, ArithmeticPolicy>
+    friend class __BasicTimecodeInt;
+
+    static constexpr bool __is_valid_tc_string(const string_view_t tc)
     {
         const auto tc_length = tc.length();
         if (tc_length != TCSTRING_SIZE_WITH_SUBFRAMES
@@ -461,8 +898,8 @@ private:
                 c = tc[i + group_index];
 
                 if (group_index < TC_GROUP_WIDTH) {
-                    // TODO: validate that digits respect max/min bounds
-                    if (!std::isdigit(c)) return false;
+                    // group limits depend on the rate, see __is_label_in_range
+                    if (c < TCSTRING_CHAR_OFFSET || c > TCSTRING_CHAR_OFFSET + 9) return false;
                 }
 
                 else if (group_index == TC_GROUP_WIDTH) {
@@ -485,6 +922,60 @@ private:
         return true;
     }
 
+    // groups of a string already checked by __is_valid_tc_string, a missing
+    // subframes group reads as zero
+    static constexpr auto __parse_tc_string(const string_view_t tc) -> groups_t
+    {
+        groups_t groups{};
+        for (std::size_t i = 0; i < tc.length(); i += TC_GROUP_WIDTH + 1) {
+            unsigned_type current = 0;
+            for (std::size_t digit = 0; digit < TC_GROUP_WIDTH; ++digit) {
+                current = (current * 10) + static_cast<unsigned_type>(tc[i + digit] - TCSTRING_CHAR_OFFSET);
+            }
+
+            groups[i / (TC_GROUP_WIDTH + 1)] = current;
+        }
+
+        return groups;
+    }
+
+    // validates and parses a label in one pass, a malformed label reads as zero groups
+    static constexpr bool __parse_label(const string_view_t tc, groups_t& groups)
+    {
+        if constexpr (__has_swar_parser) {
+            if (!std::is_constant_evaluated()) return __swar_parse_label(tc.data(), tc.length(), groups);
+        }
+
+        const bool valid = __is_valid_tc_string(tc);
+        groups = (valid) ? __parse_tc_string(tc) : groups_t{};
+        return valid;
+    }
+
+    // minutes and seconds below 60, frames below the timebase of the rate
+    static constexpr bool __is_label_in_range(const groups_t& groups, const fps_scalar_t fps)
+    {
+        return groups[TCSCALAR_MINS_START] < TCSCALAR_MINS_MAX
+            && groups[TCSCALAR_SECS_START] < TCSCALAR_SECS_MAX
+            && groups[TCSCALAR_FRAMES_START] < static_cast<unsigned_type>(fps_t::to_timebase(fps))
+            && groups[TCSCALAR_SUBFRAMES_START] < TCSCALAR_SUBFRAMES_MAX;
+    }
+
+    // the first labels of every minute but each tenth one under drop-frame counting
+    static constexpr bool __is_skipped_label(const groups_t& groups, const fps_scalar_t fps)
+    {
+        const auto timebase = static_cast<unsigned_type>(fps_t::to_timebase(fps));
+        const unsigned_type dropped = (fps_t::is_drop_frame(fps)) ? timebase / TCSCALAR_DROPFRAME_DIVISOR : 0;
+
+        return groups[TCSCALAR_SECS_START] == 0
+            && groups[TCSCALAR_MINS_START] % TCSCALAR_DROPFRAME_MINS_CYCLE != 0
+            && groups[TCSCALAR_FRAMES_START] < dropped;
+    }
+
+    static constexpr bool __is_valid_label(const groups_t& groups, const fps_scalar_t fps)
+    {
+        return __is_label_in_range(groups, fps) && !__is_skipped_label(groups, fps);
+    }
+
 ///////////////////////////////////////////////////////////////////////////
 
 
@@ -512,50 +1003,50 @@ public:
 public:
     operator signed_type() const
     {
-        return this->implicit_number_conversion_impl<signed_type>(std::make_index_sequence<TC_TOTAL_GROUPS>{});
+        return this->implicit_number_conversion_impl<signed_type>();
     }
 
     operator unsigned_type() const
     {
-        return this->implicit_number_conversion_impl<unsigned_type>(std::make_index_sequence<TC_TOTAL_GROUPS>{});
+        return this->implicit_number_conversion_impl<unsigned_type>();
     }
 
     operator float_type() const
     {
-        return this->implicit_number_conversion_impl<float_type>(std::make_index_sequence<TC_TOTAL_GROUPS>{});
+        return this->implicit_number_conversion_impl<float_type>();
     }
 
-    operator string_type() const
+    // The text of the string conversion held inline, no allocator is involved for
+    // any string type. Converts to a string view and can be stored or copied freely.
+    constexpr auto as_static_string() const noexcept -> static_string_t
     {
         char_t tc_string[TCSTRING_SIZE_WITH_SUBFRAMES + 1] = TCSTRING_DEFAULT_INITIALIZER;
         this->fill_tcstring_array(tc_string, std::make_index_sequence<TC_TOTAL_GROUPS>{});
 
-        std::size_t string_size = (this->is_flag_set<TCFLAGS_SHOW_WITH_SUBFRAMES>())
+        const std::size_t string_size = (this->is_flag_set<TCFLAGS_SHOW_WITH_SUBFRAMES>())
             ? TCSTRING_SIZE_WITH_SUBFRAMES
             : TCSTRING_SIZE_STANDARD;
 
-        string_t str(string_size, '\0');
+        return static_string_t{ tc_string, string_size };
+    }
 
-        for (std::size_t i = 0; i < string_size; ++i) {
-            str[i] = tc_string[i];
+    operator string_type() const
+    {
+        const static_string_t text = this->as_static_string();
+        string_t str(text.size(), '\0');
+
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            str[i] = text[i];
         }
 
         return str;
     }
 
 private:
-    template<TimecodePrimitive T, std::size_t... Is>
-    constexpr auto implicit_number_conversion_impl(std::index_sequence<Is...> seq) const noexcept -> T
+    template<TimecodePrimitive T>
+    constexpr auto implicit_number_conversion_impl() const noexcept -> T
     {
-        static_assert(sizeof...(Is) == TC_TOTAL_GROUPS,
-                      "index sequence of local input variable \"seq\" has more indexes "
-                      "than this->_values container, which will result in buffer overflow");
-
-        const auto fps_factor = fps_t::to_unsigned(this->_fps);
-        return (
-            (this->_values[GET_TCGRP_SCALAR_START(Is)] * CALL_TCGRP_SCALAR_VALUE_MAPPING(Is, fps_factor))
-             + ...
-        );
+        return static_cast<T>(this->_ticks);
     }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -571,171 +1062,222 @@ public:
     inline void reset() noexcept
     {
         this->_flags = TCFLAGS_DEFAULT;
-        __set_values_default(this->_values);
+        this->_ticks = 0;
     }
 
     inline void reset_all() noexcept
     {
-        this->_fps = fps_t::default_value();
+        this->_fps = static_cast<storage_t>(fps_t::default_value());
         this->_flags = TCFLAGS_DEFAULT;
-        __set_values_default(this->_values);
+        this->_ticks = 0;
     }
 
-private:
-    inline void set_values(scalar_t(&tc_values)[TC_TOTAL_GROUPS]) noexcept
+    constexpr unsigned_type ticks() const noexcept
     {
-        for (std::size_t i = 0; i < TC_TOTAL_GROUPS; ++i) {
-            this->_values[i] = tc_values[i];
-        }
+        return this->_ticks;
     }
 
-public:
-    unsigned_type ticks() const noexcept
+    // the tick count shares a word with the rate and flags, see max_ticks()
+    static constexpr auto max_ticks() noexcept -> unsigned_type
     {
-        return this->ticks_impl(std::make_index_sequence<TC_TOTAL_GROUPS>{});
+        return static_cast<unsigned_type>((storage_t{1} << TCSTORAGE_TICKS_BITS) - 1);
     }
 
-private:
-    template<std::size_t... Is>
-    inline unsigned_type ticks_impl(std::index_sequence<Is...> seq) const noexcept
-    {
-        return (
-            (this->_values[Is]
-            * CALL_TCGRP_SCALAR_VALUE_MAPPING(Is, fps_t::to_unsigned(this->_fps)))
-            + ...
-        );
-    }
-
-public:
     template<std::integral V>
-    void set_ticks(const V ticks)
+    constexpr void set_ticks(const V ticks)
     {
-        if constexpr (std::is_unsigned_v<V>) {
-            this->set_ticks_impl(ticks, std::make_index_sequence<TC_TOTAL_GROUPS>{});
+        // TODO: Is setting the value to 0 unexpected for the user?
+        // counts out of range are clamped and flagged
+        if (std::cmp_less(ticks, 0) || std::cmp_greater(ticks, max_ticks())) {
+            this->set_flag<TCFLAGS_ERROR>();
         }
 
-        else if constexpr (std::is_signed_v<V>) {
-            // TODO: Is setting the value to 0 unexpected for the user?
-            unsigned_type _ticks = 0;
-            if (ticks >= 0) {
-                _ticks = ticks;
-                this->set_flag<TCFLAGS_ERROR>();
-            }
-
-            this->set_ticks_impl(_ticks, std::make_index_sequence<TC_TOTAL_GROUPS>{});
-        }
+        this->_ticks = (std::cmp_less(ticks, 0)) ? 0 : std::min(static_cast<unsigned_type>(ticks), max_ticks());
     }
 
-private:
-    template<std::unsigned_integral T, std::size_t... Is>
-    constexpr void set_ticks_impl(T ticks, std::index_sequence<Is...> seq)
-    {
-        static_assert(sizeof...(Is) == TC_TOTAL_GROUPS,
-                      "index sequence of local input variable \"seq\" has more indexes than "
-                      "this->_values container, which will result in buffer overflow");
-
-        const unsigned_type fps_factor = fps_t::to_unsigned(this->_fps);
-        const std::array indexes = { GET_TCGRP_SCALAR_START(Is) ... };
-        const std::array factors = { CALL_TCGRP_SCALAR_VALUE_MAPPING(Is, fps_factor) ... };
-
-        // if constexpr (std::is_integral_v<T>) {
-        //     if (ticks < 0) ticks = 0;
-        // }
-        //
-        // unsigned_type unsigned_ticks = static_cast<unsigned_type>(ticks);
-
-        for (const auto& i : indexes) {
-            if (ticks >= factors[i]) {
-                // TODO: bounds checking
-                this->_values[i] = ticks / factors[i];
-                ticks %= factors[i];
-            }
-
-            else if (ticks == 0) this->_values[i] = ticks;
-        }
-    }
-
-public:
     void set_fps(const fps_scalar_t fps) noexcept
+        requires (!__is_constant_fps)
     {
         // TODO: type safety for this
-        this->_fps = fps;
+        // the timecode label is preserved, so the tick count is rebuilt for the new rate
+        const groups_t groups = this->split_ticks();
+        this->_fps = static_cast<storage_t>(fps);
+        this->_ticks = this->join_groups(groups);
     }
 
-    fps_scalar_t fps() const noexcept
+    constexpr fps_scalar_t fps() const noexcept
     {
         // TODO: wrap this in an enum class
-        return this->_fps;
+        if constexpr (__is_constant_fps) return fps_t::value;
+        else return static_cast<fps_scalar_t>(this->_fps);
     }
 
     template<std::integral T>
     void set_hours(T hours)
     {
-        const auto ticks = this->to_ticks<TCSCALAR_HRS_START>(hours);
-        this->set_ticks(ticks);
+        this->set_group<TCSCALAR_HRS_START>(hours);
     }
 
     unsigned_type hours() const noexcept
     {
-        return this->_values[TCSCALAR_HRS_START];
+        return this->group<TCSCALAR_HRS_START>();
     }
 
     template<std::integral T>
     void set_minutes(T minutes)
     {
-        const auto ticks = this->to_ticks<TCSCALAR_MINS_START>(minutes);
-        this->set_ticks(ticks);
+        this->set_group<TCSCALAR_MINS_START>(minutes);
     }
 
     unsigned_type minutes() const noexcept
     {
-        return this->_values[TCSCALAR_MINS_START];
+        return this->group<TCSCALAR_MINS_START>();
     }
 
     template<std::integral T>
     void set_seconds(T seconds)
     {
-        const auto ticks = this->to_ticks<TCSCALAR_SECS_START>(seconds);
-        this->set_ticks(ticks);
+        this->set_group<TCSCALAR_SECS_START>(seconds);
     }
 
     unsigned_type seconds() const noexcept
     {
-        return this->_values[TCSCALAR_SECS_START];
+        return this->group<TCSCALAR_SECS_START>();
     }
 
     template<std::integral T>
     void set_frames(T frames)
     {
-        const auto ticks = this->to_ticks<TCSCALAR_FRAMES_START>(frames);
-        this->set_ticks(ticks);
+        this->set_group<TCSCALAR_FRAMES_START>(frames);
     }
 
     unsigned_type frames() const noexcept
     {
-        return this->_values[TCSCALAR_FRAMES_START];
+        return this->group<TCSCALAR_FRAMES_START>();
     }
 
     template<std::integral T>
     void set_subframes(T subframes)
     {
-        const auto ticks = this->to_ticks<TCSCALAR_SUBFRAMES_START>(subframes);
-        this->set_ticks(ticks);
+        this->set_group<TCSCALAR_SUBFRAMES_START>(subframes);
     }
 
     unsigned_type subframes() const noexcept
     {
-        return this->_values[TCSCALAR_SUBFRAMES_START];
+        return this->group<TCSCALAR_SUBFRAMES_START>();
     }
 
-    bool is_drop_frame() const noexcept
+    constexpr bool is_drop_frame() const noexcept
     {
-        return fps_t::is_drop_frame(this->_fps);
+        if constexpr (__is_constant_fps) {
+            constexpr bool drop_frame = fps_t::is_drop_frame(fps_t::value);
+            return drop_frame;
+        }
+
+        else return fps_t::is_drop_frame(this->fps());
     }
 
-    bool is_negative() const noexcept
+    constexpr auto rate() const noexcept
     {
-        VTM_TODO("not implemented");
+        if constexpr (__is_constant_fps) {
+            constexpr auto rate = fps_t::to_rational(fps_t::value);
+            return rate;
+        }
+
+        else return fps_t::to_rational(this->fps());
+    }
+
+    // labels never fall before 00:00:00:00, signed offsets are held by durations
+    constexpr bool is_negative() const noexcept
+    {
+        return false;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Time Conversions --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // elapsed time in units of 1 / units_per_second (e.g. 1000 for milliseconds),
+    // rounded towards zero. Uses the exact rational rate in integer math, so there
+    // is no accumulated error over long durations.
+    constexpr auto to_time(const unsigned_type units_per_second) const -> unsigned_type
+    {
+        const auto rate = this->rate();
+        return cxxtc::utility::internal::muldiv(this->_ticks,
+                                                rate.denominator * units_per_second,
+                                                rate.numerator * TCSCALAR_SUBFRAMES_PER_FRAMES);
+    }
+
+    // sets the tick count to the last subframe at or before the elapsed time
+    constexpr void set_time(const unsigned_type time, const unsigned_type units_per_second)
+    {
+        const auto rate = this->rate();
+        this->set_ticks(cxxtc::utility::internal::muldiv(time,
+                                                         rate.numerator * TCSCALAR_SUBFRAMES_PER_FRAMES,
+                                                         rate.denominator * units_per_second));
+    }
+
+    // Elapsed time as a std::chrono::duration with an integer count, rounded when
+    // the instant falls between two units. Integer math on the exact rational
+    // rate, the duration must be able to hold the elapsed time.
+    template<cxxtc::traits::IntegralDuration TDuration>
+    constexpr auto to_duration(const __Rounding rounding = __Rounding::down) const -> TDuration
+    {
+        using period = typename TDuration::period;
+        const auto rate = this->rate();
+
+        const std::uint64_t count = __muldiv_rounded(this->_ticks,
+                                                     rate.denominator * static_cast<std::uint64_t>(period::den),
+                                                     rate.numerator * TCSCALAR_SUBFRAMES_PER_FRAMES * static_cast<std::uint64_t>(period::num),
+                                                     rounding);
+
+        return TDuration{ static_cast<typename TDuration::rep>(count) };
+    }
+
+    // Sets the tick count to the whole frame at the elapsed time, e.g. of a capture
+    // timestamp from std::chrono::steady_clock, rounded when it falls between two
+    // frames. Negative durations set the error flag.
+    template<cxxtc::traits::IntegralDuration TDuration>
+    constexpr void set_duration(const TDuration time, const __Rounding rounding = __Rounding::down)
+    {
+        using period = typename TDuration::period;
+        const auto rate = this->rate();
+
+        if (time.count() < 0) {
+            this->set_ticks(time.count());
+            return;
+        }
+
+        const std::uint64_t frames = __muldiv_rounded(static_cast<std::uint64_t>(time.count()),
+                                                      rate.numerator * static_cast<std::uint64_t>(period::num),
+                                                      rate.denominator * static_cast<std::uint64_t>(period::den),
+                                                      rounding);
+
+        this->set_ticks(std::min<std::uint64_t>(frames, max_ticks() / TCSCALAR_SUBFRAMES_PER_FRAMES + 1) * TCSCALAR_SUBFRAMES_PER_FRAMES);
+    }
+
+    // the tick count of the same instant at another fps, e.g. for conforming a
+    // 25 fps event list to 23.976; the rate pair ratio comes from a table
+    constexpr auto ticks_at(const fps_scalar_t fps, const __Rounding rounding = __Rounding::nearest) const -> unsigned_type
+    {
+        if (!__is_constant_fps && fps == this->fps()) return this->_ticks;
+        return __convert_ticks(this->_ticks, this->rate_conversion(fps), rounding);
+    }
+
+    // the same instant at another fps, keeping the flags of this timecode
+    constexpr auto to_fps(const fps_scalar_t fps, const __Rounding rounding = __Rounding::nearest) const -> __my_type
+        requires (!__is_constant_fps)
+    {
+        __my_type tc = *this;
+        tc._ticks = this->ticks_at(fps, rounding);
+        tc._fps = static_cast<storage_t>(fps);
+        return tc;
     }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -793,7 +1335,7 @@ public:
     friend constexpr bool operator==(const __my_type& lhs, const Rhs& rhs)
     {
         if constexpr (std::is_same_v<Rhs, __my_type>)
-            return lhs.ticks() == rhs.ticks();
+            return std::is_eq(lhs <=> rhs);
 
         else if constexpr (std::is_unsigned_v<Rhs>)
             return lhs.ticks() == rhs;
@@ -805,24 +1347,29 @@ public:
         }
     }
 
+    // timecodes order by the instant they label: when the rates differ both tick
+    // counts are scaled exactly into a common timebase, so 00:00:01:00 at 25 fps is
+    // equivalent to 00:00:01:00 at 30 fps, but not interchangeable with it
     template<typename Rhs>
         requires std::is_same_v<Rhs, __my_type> || std::is_integral_v<Rhs>
     friend constexpr auto operator<=>(const __my_type& lhs, const Rhs& rhs)
     {
         if constexpr (std::is_same_v<Rhs, __my_type>) {
-            /* return lhs_value <=> rhs_value; */
-            if (lhs.ticks() == rhs.ticks()) return std::strong_ordering::equal;
-            if (lhs.ticks() < rhs.ticks()) return std::strong_ordering::less;
-            if (lhs.ticks() > rhs.ticks()) return std::strong_ordering::greater;
-            return std::strong_ordering::equivalent;
+            if (__is_constant_fps || lhs.fps() == rhs.fps()) {
+                return std::weak_ordering{ lhs.ticks() <=> rhs.ticks() };
+            }
+
+            const __RateConversion& conversion = lhs.rate_conversion(rhs.fps());
+            return std::weak_ordering{
+                cxxtc::utility::internal::compare_products(lhs.ticks(), conversion.multiplier,
+                                                           rhs.ticks(), conversion.divisor)
+            };
         }
 
         else if constexpr (std::is_integral_v<Rhs>) {
-            /* return lhs_value <=> rhs; */
-            if (lhs.ticks() == rhs) return std::strong_ordering::equal;
-            if (lhs.ticks() < rhs) return std::strong_ordering::less;
-            if (lhs.ticks() > rhs) return std::strong_ordering::greater;
-            return std::strong_ordering::equivalent;
+            if (std::cmp_equal(lhs.ticks(), rhs)) return std::strong_ordering::equal;
+            if (std::cmp_less(lhs.ticks(), rhs)) return std::strong_ordering::less;
+            return std::strong_ordering::greater;
         }
     }
 
@@ -836,18 +1383,19 @@ public:
 ///////////////////////////////////////////////////////////////////////////
 
 public:
+    // +, - and * go through the arithmetic policy, which decides what happens when a
+    // result leaves the range of the tick count; results keep the fps of lhs, and a
+    // timecode rhs at another rate is first moved to that fps, rounding to nearest
     template<typename Rhs>
         requires std::is_same_v<Rhs, __my_type> || std::is_integral_v<Rhs>
-    friend constexpr void operator+=(__my_type& lhs, const Rhs& rhs)
+    friend constexpr __my_type& operator+=(__my_type& lhs, const Rhs& rhs)
     {
-        // TODO: handle bounds
         if constexpr (std::is_same_v<Rhs, __my_type>) {
-            lhs.set_ticks(lhs.ticks() + rhs.ticks());
+            return lhs.apply_arithmetic(arithmetic_t::template add<unsigned_type, unsigned_type>, rhs.ticks_at(lhs.fps()));
         }
 
-        // TODO: handle bounds
         else if constexpr (std::is_integral_v<Rhs>) {
-            lhs.set_ticks(lhs.ticks() + rhs);
+            return lhs.apply_arithmetic(arithmetic_t::template add<unsigned_type, Rhs>, rhs);
         }
     }
 
@@ -855,16 +1403,12 @@ public:
         requires std::is_same_v<Rhs, __my_type> || std::is_integral_v<Rhs>
     friend constexpr __my_type& operator-=(__my_type& lhs, const Rhs& rhs)
     {
-        // TODO: handle bounds
         if constexpr (std::is_same_v<Rhs, __my_type>) {
-            lhs.set_ticks(lhs.ticks() - rhs.ticks());
-            return lhs;
+            return lhs.apply_arithmetic(arithmetic_t::template sub<unsigned_type, unsigned_type>, rhs.ticks_at(lhs.fps()));
         }
 
-        // TODO: handle bounds
         else if constexpr (std::is_integral_v<Rhs>) {
-            lhs.set_ticks(lhs.ticks() - rhs);
-            return lhs;
+            return lhs.apply_arithmetic(arithmetic_t::template sub<unsigned_type, Rhs>, rhs);
         }
     }
 
@@ -872,16 +1416,12 @@ public:
         requires std::is_same_v<Rhs, __my_type> || std::is_integral_v<Rhs>
     friend constexpr __my_type& operator*=(__my_type& lhs, const Rhs& rhs)
     {
-        // TODO: handle bounds
         if constexpr (std::is_same_v<Rhs, __my_type>) {
-            lhs.set_ticks(lhs.ticks() * rhs.ticks());
-            return lhs;
+            return lhs.apply_arithmetic(arithmetic_t::template mul<unsigned_type, unsigned_type>, rhs.ticks_at(lhs.fps()));
         }
 
-        // TODO: handle bounds
         else if constexpr (std::is_integral_v<Rhs>) {
-            lhs.set_ticks(lhs.ticks() * rhs);
-            return lhs;
+            return lhs.apply_arithmetic(arithmetic_t::template mul<unsigned_type, Rhs>, rhs);
         }
     }
 
@@ -889,113 +1429,90 @@ public:
         requires std::is_same_v<Rhs, __my_type> || std::is_integral_v<Rhs>
     friend constexpr __my_type& operator/=(__my_type& lhs, const Rhs& rhs)
     {
-        // TODO: handle bounds
         if constexpr (std::is_same_v<Rhs, __my_type>) {
-            assert(rhs.ticks() > 0
+            const unsigned_type divisor = rhs.ticks_at(lhs.fps());
+            assert(divisor > 0
                    && "division by zero in __BasicTimecode expression will result in undefined behaviour");
 
-            lhs.set_ticks(lhs.ticks() / rhs.ticks());
+            lhs._ticks /= divisor;
             return lhs;
         }
 
-        // TODO: handle bounds
         else if constexpr (std::is_integral_v<Rhs>) {
-            assert(rhs.ticks() > 0
+            assert(rhs > 0
                    && "division by zero in __BasicTimecode expression will result in undefined behaviour");
 
-            lhs.set_ticks(lhs.ticks() / rhs);
+            lhs._ticks /= static_cast<unsigned_type>(rhs);
             return lhs;
         }
     }
 
     template<typename Rhs>
         requires std::is_same_v<Rhs, __my_type> || std::is_integral_v<Rhs>
-    friend constexpr __my_type operator+(const __my_type& lhs, const Rhs& rhs)
+    friend constexpr __my_type operator+(__my_type lhs, const Rhs& rhs)
     {
-        // TODO: handle bounds
-        if constexpr (std::is_same_v<Rhs, __my_type>) {
-            return __my_type{ lhs.ticks() + rhs.ticks() };
-        }
-
-        // TODO: handle bounds
-        else if constexpr (std::is_integral_v<Rhs>) {
-            return __my_type{ lhs.ticks() + rhs };
-        }
+        return lhs += rhs;
     }
 
     template<typename Rhs>
         requires std::is_same_v<Rhs, __my_type> || std::is_integral_v<Rhs>
-    friend constexpr __my_type operator-(const __my_type& lhs, const Rhs& rhs)
+    friend constexpr __my_type operator-(__my_type lhs, const Rhs& rhs)
     {
-        // TODO: handle bounds
-        if constexpr (std::is_same_v<Rhs, __my_type>) {
-            return __my_type{ lhs.ticks() - rhs.ticks() };
-        }
-
-        // TODO: handle bounds
-        else if constexpr (std::is_integral_v<Rhs>) {
-            return __my_type{ lhs.ticks() - rhs };
-        }
+        return lhs -= rhs;
     }
 
     template<typename Rhs>
         requires std::is_same_v<Rhs, __my_type> || std::is_integral_v<Rhs>
-    friend constexpr __my_type operator*(const __my_type& lhs, const Rhs& rhs)
+    friend constexpr __my_type operator*(__my_type lhs, const Rhs& rhs)
     {
-        // TODO: handle bounds
-        if constexpr (std::is_same_v<Rhs, __my_type>) {
-            return __my_type{ lhs.ticks() * rhs.ticks() };
-        }
-
-        // TODO: handle bounds
-        else if constexpr (std::is_integral_v<Rhs>) {
-            return __my_type{ lhs.ticks() * rhs };
-        }
+        return lhs *= rhs;
     }
 
     template<typename Rhs>
         requires std::is_same_v<Rhs, __my_type> || std::is_integral_v<Rhs>
-    friend constexpr __my_type operator/(const __my_type& lhs, const Rhs& rhs)
+    friend constexpr __my_type operator/(__my_type lhs, const Rhs& rhs)
     {
-        // TODO: handle bounds
-        if constexpr (std::is_same_v<Rhs, __my_type>) {
-            assert(rhs.ticks() > 0
-                   && "division by zero in __BasicTimecode expression will result in undefined behaviour");
-
-            return __my_type{ lhs.ticks() / rhs.ticks() };
-        }
-
-        // TODO: handle bounds
-        else if constexpr (std::is_integral_v<Rhs>) {
-            assert(rhs > 0
-                   && "division by zero in __BasicTimecode expression will result in undefined behaviour");
-
-            return __my_type{ lhs.ticks() / rhs };
-        }
+        return lhs /= rhs;
     }
 
-    __my_type& operator++() {
-        this->set_ticks(this->ticks() + 1);
-        return *this;
+    // the tick count is the canonical state, so stepping never touches the
+    // groups: carries into seconds, minutes and hours fall out of the count
+    constexpr __my_type& operator++() {
+        return *this += 1;
     }
 
-    __my_type operator++(int) {
+    constexpr __my_type operator++(int) {
         auto tmp = *this;
-        this->set_ticks(this->ticks() + 1);
+        ++(*this);
         return tmp;
     }
 
-    __my_type& operator--() {
-        this->set_ticks(this->ticks() - 1);
-        return *this;
+    constexpr __my_type& operator--() {
+        return *this -= 1;
     }
 
-    __my_type operator--(int) {
+    constexpr __my_type operator--(int) {
         auto tmp = *this;
-        this->set_ticks(this->ticks() - 1);
+        --(*this);
         return tmp;
     }
 
+    // moves by whole frames, keeping the current subframe offset
+    template<std::integral T>
+    constexpr __my_type& advance_frames(const T frames) noexcept
+    {
+        using step_t = std::conditional_t<std::is_signed_v<T>, signed_type, unsigned_type>;
+        return *this += static_cast<step_t>(frames) * TCSCALAR_SUBFRAMES_PER_FRAMES;
+    }
+
+    // moves by whole frames and lands on a frame boundary, discarding subframes
+    template<std::integral T = int>
+    constexpr __my_type& step_frames(const T frames = 1) noexcept
+    {
+        this->_ticks -= this->_ticks % TCSCALAR_SUBFRAMES_PER_FRAMES;
+        return this->advance_frames(frames);
+    }
+
 ///////////////////////////////////////////////////////////////////////////
 
 
@@ -1006,6 +1523,18 @@ public:
 ///////////////////////////////////////////////////////////////////////////
 
 public:
+    // set by a negative set_ticks() or by arithmetic that leaves the range of the
+    // tick count under the checked policy, and kept until cleared
+    constexpr bool has_error() const noexcept
+    {
+        return this->is_flag_set<TCFLAGS_ERROR>();
+    }
+
+    constexpr void clear_error() noexcept
+    {
+        this->unset_flag<TCFLAGS_ERROR>();
+    }
+
     inline __my_type& enable_extended_string(bool enable = true)
     {
         if (enable) {
@@ -1054,17 +1583,181 @@ private:
 ///////////////////////////////////////////////////////////////////////////
 
 private:
+    // with a compile-time rate every factor below is a constant, so the divisions
+    // that split the tick count compile down to multiplies and shifts
+    constexpr auto timebase() const -> unsigned_type
+    {
+        if constexpr (__is_constant_fps) {
+            constexpr unsigned_type timebase = fps_t::to_timebase(fps_t::value);
+            return timebase;
+        }
+
+        else return fps_t::to_timebase(this->fps());
+    }
+
+    constexpr auto tick_factors() const -> groups_t
+    {
+        if constexpr (__is_constant_fps) {
+            constexpr groups_t factors = __tick_factors(fps_t::to_timebase(fps_t::value),
+                                                        std::make_index_sequence<TC_TOTAL_GROUPS>{});
+            return factors;
+        }
+
+        else return __tick_factors(this->timebase(), std::make_index_sequence<TC_TOTAL_GROUPS>{});
+    }
+
+    template<std::size_t Index>
+    constexpr auto tick_factor() const -> unsigned_type
+    {
+        static_assert(Index < TC_TOTAL_GROUPS, "index for static data member tick_groups must be less than TC_TOTAL_GROUPS");
+        return CALL_TCGRP_SCALAR_VALUE_MAPPING(Index, this->timebase());
+    }
+
+    constexpr auto rate_divisors() const -> const __RateDivisors&
+    {
+        return __rate_divisors[static_cast<std::size_t>(this->fps())];
+    }
+
+    // a run-time rate divides through the precomputed reciprocal of its tick factor,
+    // a compile-time rate leaves the constant division to the compiler
+    constexpr auto divide_by_factor(const unsigned_type ticks, const std::size_t index) const -> unsigned_type
+    {
+        if constexpr (__is_constant_fps) return ticks / this->tick_factors()[index];
+        else return static_cast<unsigned_type>(this->rate_divisors().tick_factors[index].divide(ticks));
+    }
+
+    constexpr auto rate_conversion(const fps_scalar_t to) const -> const __RateConversion&
+    {
+        return __rate_conversions[static_cast<std::size_t>(this->fps())][static_cast<std::size_t>(to)];
+    }
+
+    constexpr auto ticks_per_day() const -> cxxtc::utility::fast_divisor
+    {
+        if constexpr (__is_constant_fps) {
+            constexpr cxxtc::utility::fast_divisor day{
+                __ticks_per_day(fps_t::to_timebase(fps_t::value), fps_t::is_drop_frame(fps_t::value))
+            };
+
+            return day;
+        }
+
+        else return this->rate_divisors().day;
+    }
+
+    template<typename TOperation, std::integral T>
+    constexpr auto apply_arithmetic(TOperation operation, const T rhs) -> __my_type&
+    {
+        bool error = false;
+        const unsigned_type result = operation(static_cast<unsigned_type>(this->_ticks), rhs, this->ticks_per_day(), error);
+        this->_ticks = arithmetic_t::narrow(result, max_ticks(), error);
+        this->_flags |= static_cast<flags_t>(static_cast<flags_t>(error) << TCFLAGS_MASK_ERROR_INDEX);
+        return *this;
+    }
+
+    // label ticks count every timecode label, including the labels that are
+    // skipped by drop-frame rates, so groups can be split with fixed factors
+    constexpr auto to_label_ticks(const unsigned_type ticks) const -> unsigned_type
+    {
+        if (!this->is_drop_frame()) return ticks;
+
+        const unsigned_type frames = ticks / TCSCALAR_SUBFRAMES_PER_FRAMES;
+        const unsigned_type subframes = ticks % TCSCALAR_SUBFRAMES_PER_FRAMES;
+
+        if constexpr (__is_constant_fps) {
+            return (__dropframe_to_label(frames, this->timebase()) * TCSCALAR_SUBFRAMES_PER_FRAMES) + subframes;
+        }
+
+        else {
+            const __RateDivisors& divisors = this->rate_divisors();
+            const unsigned_type label = __dropframe_to_label(
+                frames, this->timebase(),
+                [&](const unsigned_type n) { return static_cast<unsigned_type>(divisors.dropframe_cycle.divide(n)); },
+                [&](const unsigned_type n) { return static_cast<unsigned_type>(divisors.dropframe_minute.divide(n)); }
+            );
+
+            return (label * TCSCALAR_SUBFRAMES_PER_FRAMES) + subframes;
+        }
+    }
+
+    constexpr auto from_label_ticks(const unsigned_type label_ticks) const -> unsigned_type
+    {
+        if (!this->is_drop_frame()) return label_ticks;
+
+        const unsigned_type label = label_ticks / TCSCALAR_SUBFRAMES_PER_FRAMES;
+        const unsigned_type subframes = label_ticks % TCSCALAR_SUBFRAMES_PER_FRAMES;
+        const unsigned_type total_minutes = this->divide_by_factor(label_ticks, TCSCALAR_MINS_START);
+
+        return (__dropframe_from_label(label, this->timebase(), total_minutes) * TCSCALAR_SUBFRAMES_PER_FRAMES) + subframes;
+    }
+
+    // groups are derived from the tick count on demand: each group is the remainder
+    // of the group above it divided by its own factor
+    template<std::size_t Index>
+    constexpr auto group() const -> unsigned_type
+    {
+        const unsigned_type label_ticks = this->to_label_ticks(this->_ticks);
+
+        if constexpr (Index == TCSCALAR_HRS_START) {
+            return this->divide_by_factor(label_ticks, Index);
+        }
+
+        else {
+            const unsigned_type above = this->divide_by_factor(label_ticks, Index - 1);
+            return this->divide_by_factor(label_ticks - (above * this->tick_factor<Index - 1>()), Index);
+        }
+    }
+
+    constexpr auto split_ticks() const -> groups_t
+    {
+        const groups_t factors = this->tick_factors();
+        groups_t groups{};
+
+        unsigned_type ticks = this->to_label_ticks(this->_ticks);
+        for (std::size_t i = 0; i < TC_TOTAL_GROUPS; ++i) {
+            groups[i] = this->divide_by_factor(ticks, i);
+            ticks -= groups[i] * factors[i];
+        }
+
+        return groups;
+    }
+
+    constexpr auto join_groups(const groups_t& groups) const -> unsigned_type
+    {
+        const groups_t factors = this->tick_factors();
+
+        unsigned_type label_ticks = 0;
+        for (std::size_t i = 0; i < TC_TOTAL_GROUPS; ++i) {
+            label_ticks += groups[i] * factors[i];
+        }
+
+        return this->from_label_ticks(label_ticks);
+    }
+
+    // replaces the groups from the most significant group of the new value downward,
+    // groups above it are left as they were
     template<std::size_t Index, std::integral T>
-    constexpr auto to_ticks(T value) const -> cxxtc::traits::to_unsigned_t<T>
+    constexpr void set_group(T value)
     {
         // TODO: Set negative flag if value < 0 ???
-        if (value <= 0) return 0;
+        if (value <= 0) {
+            this->_ticks = 0;
+            return;
+        }
 
-        static_assert(Index < TC_TOTAL_GROUPS, "index for static data member tick_groups must be less than TC_TOTAL_GROUPS");
-        const unsigned_type tick_factor = CALL_TCGRP_SCALAR_VALUE_MAPPING(Index,
-                                                                          fps_t::to_unsigned(this->_fps));
+        const groups_t factors = this->tick_factors();
+        const unsigned_type ticks = static_cast<unsigned_type>(value) * factors[Index];
+
+        std::size_t top = 0;
+        while (ticks < factors[top]) ++top;
+
+        if (top == TCSCALAR_HRS_START) {
+            this->_ticks = this->from_label_ticks(ticks);
+        }
 
-        return value * tick_factor;
+        else {
+            const unsigned_type label_ticks = this->to_label_ticks(this->_ticks);
+            this->_ticks = this->from_label_ticks((label_ticks / factors[top - 1]) * factors[top - 1] + ticks);
+        }
     }
 
     template<std::size_t I, std::size_t Size, std::size_t... Is>
@@ -1079,9 +1772,12 @@ private:
     template<std::size_t StrSize, std::size_t... Is>
     constexpr void fill_tcstring_array(char_t(&tcstring)[StrSize], std::index_sequence<Is...> seq) const
     {
+        const groups_t groups = this->split_ticks();
+        tcstring[TCSTRING_FRAMES_START - 1] = (this->is_drop_frame()) ? TCSTRING_COLON_DROPFRAME : TCSTRING_COLON_DEFAULT;
+
         char_t grp_string[TC_GROUP_WIDTH] = TCSTRING_GROUP_DEFAULT;
         ((array_set<GET_TCGRP_STRING_START(Is), StrSize>(tcstring,
-                                                        CALL_TCGRP_STRING_MAPPING(Is, this->_values[GET_TCGRP_SCALAR_START(Is)], grp_string),
+                                                        CALL_TCGRP_STRING_MAPPING(Is, groups[GET_TCGRP_SCALAR_START(Is)], grp_string),
                                                         std::make_index_sequence<TC_GROUP_WIDTH>{})
         ), ... );
     }
@@ -1123,29 +1819,19 @@ private:
 
 public:
     template<std::size_t Index>
-    auto&& get()        & { return this->get_helper<Index>(*this); }
-
-    template<std::size_t Index>
-    auto&& get()       && { return this->get_helper<Index>(*this); }
-
-    template<std::size_t Index>
-    auto&& get()  const & { return this->get_helper<Index>(*this); }
-
-    template<std::size_t Index>
-    auto&& get() const && { return this->get_helper<Index>(*this); }
-
+    auto get() const { return this->get_helper<Index>(); }
 
 private:
-    template<std::size_t Index, typename T>
-    auto&& get_helper(T&& t) const
+    template<std::size_t Index>
+    auto get_helper() const
     {
         static_assert(Index < 6, "index out of bounds for __BasicTimecodeInt"); // TODO: constant for magic number
-        if constexpr (Index == 0) return std::forward<T>(t)._values[TCSCALAR_HRS_START];
-        if constexpr (Index == 1) return std::forward<T>(t)._values[TCSCALAR_MINS_START];
-        if constexpr (Index == 2) return std::forward<T>(t)._values[TCSCALAR_SECS_START];
-        if constexpr (Index == 3) return std::forward<T>(t)._values[TCSCALAR_FRAMES_START];
-        if constexpr (Index == 4) return std::forward<T>(t)._values[TCSCALAR_SUBFRAMES_START];
-        if constexpr (Index == 5) return std::forward<T>(t)._fps;
+        if constexpr (Index == 0) return this->group<TCSCALAR_HRS_START>();
+        if constexpr (Index == 1) return this->group<TCSCALAR_MINS_START>();
+        if constexpr (Index == 2) return this->group<TCSCALAR_SECS_START>();
+        if constexpr (Index == 3) return this->group<TCSCALAR_FRAMES_START>();
+        if constexpr (Index == 4) return this->group<TCSCALAR_SUBFRAMES_START>();
+        if constexpr (Index == 5) return this->fps();
     }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -1158,14 +1844,31 @@ private:
 ///////////////////////////////////////////////////////////////////////////
 
 private:
-    fps_scalar_t _fps = fps_t::default_value();
-    flags_t _flags = TCFLAGS_DEFAULT;
-    scalar_t _values[TC_TOTAL_GROUPS] = {0};
+    // rate, flags and tick count share one 64-bit word; the tick count takes the
+    // high bits so carries out of it leave the other fields alone
+    storage_t _fps : TCSTORAGE_FPS_BITS = static_cast<storage_t>(fps_t::default_value());
+    storage_t _flags : TCSTORAGE_FLAGS_BITS = TCFLAGS_DEFAULT;
+    storage_t _ticks : TCSTORAGE_TICKS_BITS = 0;
 };
 
 ///////////////////////////////////////////////////////////////////////////
 
 #undef TC_GROUP_WIDTH
+#undef TC_EMPTY_BASES
+#undef TCSWAR_DIGITS_LOW
+#undef TCSWAR_COLONS_LOW
+#undef TCSWAR_EXPECTED_LOW
+#undef TCSWAR_DIGITS_HIGH
+#undef TCSWAR_COLONS_HIGH
+#undef TCSWAR_EXPECTED_HIGH
+#undef TCSWAR_PADDING_STANDARD
+#undef TCSWAR_PADDING_WITH_SUBFRAMES
+#undef TCSWAR_ZEROS
+#undef TCSWAR_HIGH_NIBBLES
+#undef TCSWAR_DIGIT_CARRY
+#undef TCSTORAGE_FPS_BITS
+#undef TCSTORAGE_FLAGS_BITS
+#undef TCSTORAGE_TICKS_BITS
 #undef TC_TOTAL_GROUPS
 #undef TC_FLAGS_SIZE
 
@@ -1194,6 +1897,11 @@ private:
 #undef TCSCALAR_FRAMES_MAX
 #undef TCSCALAR_SUBFRAMES_MAX
 
+#undef TCSCALAR_DROPFRAME_DIVISOR
+#undef TCSCALAR_DROPFRAME_MINS_CYCLE
+
+#undef TCSCALAR_DAY_HRS
+
 #undef TCSCALAR_HRS_TICKS
 #undef TCSCALAR_MINS_TICKS
 #undef TCSCALAR_SECS_TICKS
@@ -1240,8 +1948,6 @@ private:
 #undef TCFLAGS_IS_DROPFRAME
 #undef TCFLAGS_ERROR
 
-#undef UNWRAP_TCVALUES
-#undef TCVALUES_DEFAULT_INITIALIZER
 #undef TCSTRING_DEFAULT_INITIALIZER
 
 #undef __TEMPLATE_TYPE
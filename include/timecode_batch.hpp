@@ -0,0 +1,587 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Batch parsing and formatting of timecode strings for bulk ingest and export
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+// Library headers
+#include "timecode_basic.hpp"
+#include "timecode_common.hpp"
+#include "utility.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+#ifndef VTM_TIMECODE_BATCH_MACROS
+#define VTM_TIMECODE_BATCH_MACROS
+
+// vector kernels are compiled per function with target attributes and picked at
+// run time, so the rest of the library builds for the baseline instruction set
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define TCBATCH_HAS_X86_KERNELS 1
+#include <immintrin.h>
+#else
+#define TCBATCH_HAS_X86_KERNELS 0
+#endif
+
+#endif // @END OF VTM_TIMECODE_BATCH_MACROS
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace cxxtc::chrono::internal {
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Batch Parser Static Config --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#define TCBATCH_BLOCK_SIZE 8
+#define TCBATCH_FIELD_STRIDE 16
+#define TCBATCH_TOTAL_GROUPS 5
+#define TCBATCH_RECORD_GROUPS 4
+#define TCBATCH_DIGIT_PAIRS 100
+#define TCBATCH_SIZE_STANDARD 11
+#define TCBATCH_SIZE_WITH_SUBFRAMES 14
+#define TCBATCH_CHAR_OFFSET '0'
+#define TCBATCH_COLON_DEFAULT ':'
+#define TCBATCH_COLON_DROPFRAME ';'
+#define TCBATCH_COLON_SUBFRAMES '.'
+#define TCBATCH_SUBFRAMES_PER_FRAMES 100
+#define TCBATCH_SECS_PER_MIN 60
+#define TCBATCH_MINS_PER_HR 60
+#define TCBATCH_DROPFRAME_DIVISOR 15
+#define TCBATCH_DROPFRAME_MINS_CYCLE 10
+
+// byte masks of the digit and separator positions in an 11 or 14 char field
+#define TCBATCH_DIGITS_STANDARD 0b0000'0110'1101'1011
+#define TCBATCH_DIGITS_WITH_SUBFRAMES 0b0011'0110'1101'1011
+#define TCBATCH_COLONS_STANDARD 0b0000'0001'0010'0100
+#define TCBATCH_COLONS_WITH_SUBFRAMES 0b0000'1001'0010'0100
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Batch Parser Kernels
+//
+///////////////////////////////////////////////////////////////////////////
+
+enum class __BatchIsa : std::uint8_t
+{
+    scalar,
+    sse42,
+    avx2
+};
+
+// Kernels read each field straight from its source through the pointers of a
+// block, fields of any other length point at a placeholder and never match.
+// Kernels write the five groups of each row and a bit per row whose format is valid.
+struct __BatchBlock
+{
+    std::array<const char*, TCBATCH_BLOCK_SIZE> fields;
+    std::array<std::uint8_t, TCBATCH_BLOCK_SIZE> lengths;
+    // vector kernels store eight 16-bit lanes per row, the last row spills into the padding
+    std::array<std::uint16_t, (TCBATCH_BLOCK_SIZE * TCBATCH_TOTAL_GROUPS) + 8> groups;
+    std::uint32_t valid;
+};
+
+// readable as a standard length field by every kernel
+static constexpr char __batch_placeholder[TCBATCH_SIZE_STANDARD + 1] = "00:00:00:00";
+
+// upper bounds of each group, frames are bounded by the timebase of the rate
+struct __BatchLimits
+{
+    std::array<std::uint16_t, TCBATCH_TOTAL_GROUPS> bounds;
+};
+
+// only the lengths 11 and 14 have any expected positions, other lengths never match
+static constexpr auto __batch_expected_digits(const std::size_t length) -> std::uint32_t
+{
+    return (length == TCBATCH_SIZE_WITH_SUBFRAMES) ? TCBATCH_DIGITS_WITH_SUBFRAMES
+         : (length == TCBATCH_SIZE_STANDARD)       ? TCBATCH_DIGITS_STANDARD
+         : 0;
+}
+
+static constexpr auto __batch_expected_colons(const std::size_t length) -> std::uint32_t
+{
+    return (length == TCBATCH_SIZE_WITH_SUBFRAMES) ? TCBATCH_COLONS_WITH_SUBFRAMES
+         : (length == TCBATCH_SIZE_STANDARD)       ? TCBATCH_COLONS_STANDARD
+         : 0;
+}
+
+// the SWAR label parser of the string constructor, one row at a time
+static inline void __parse_block_scalar(__BatchBlock& block, const __BatchLimits& limits)
+{
+    block.valid = 0;
+    for (std::size_t row = 0; row < TCBATCH_BLOCK_SIZE; ++row) {
+        std::array<std::uint16_t, TCBATCH_TOTAL_GROUPS> groups;
+        bool valid = __swar_parse_label(block.fields[row], block.lengths[row], groups);
+
+        for (std::size_t group = 0; group < TCBATCH_TOTAL_GROUPS; ++group) {
+            block.groups[(row * TCBATCH_TOTAL_GROUPS) + group] = groups[group];
+            valid = valid && groups[group] < limits.bounds[group];
+        }
+
+        block.valid |= static_cast<std::uint32_t>(valid) << row;
+    }
+}
+
+#if TCBATCH_HAS_X86_KERNELS
+
+// The vector kernels work on one 16-byte row per 128-bit lane:
+//   1. subtract '0' and check digit rows with an unsigned min against 9
+//   2. compare the separators against the expected ':' / '.' and the ';' alternative
+//   3. shuffle the ten digits to the front and combine digit pairs with maddubs
+//   4. compare the five 16-bit groups against the limits of the rate
+// Byte masks from movemask are checked against the masks expected for the length
+// of each field. AVX2 runs the same steps on two rows per register.
+
+// Builds the 16-byte row of a field in a register from two overlapping 8-byte
+// loads, which never read past the field. Bytes past the end are filled with '0'
+// so a short field parses as zero subframes.
+__attribute__((target("sse4.2")))
+static inline auto __load_row_sse42(const char* field, const std::size_t length) -> __m128i
+{
+    const __m128i head = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(field));
+
+    if (length == TCBATCH_SIZE_WITH_SUBFRAMES) {
+        const __m128i tail = _mm_slli_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(field + TCBATCH_SIZE_WITH_SUBFRAMES - 8)),
+                                            TCBATCH_SIZE_WITH_SUBFRAMES - 8);
+        const __m128i padding = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, TCBATCH_CHAR_OFFSET, TCBATCH_CHAR_OFFSET);
+        return _mm_or_si128(_mm_or_si128(head, tail), padding);
+    }
+
+    const __m128i tail = _mm_slli_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(field + TCBATCH_SIZE_STANDARD - 8)),
+                                        TCBATCH_SIZE_STANDARD - 8);
+    const __m128i padding = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, TCBATCH_CHAR_OFFSET, TCBATCH_CHAR_OFFSET,
+                                          TCBATCH_CHAR_OFFSET, TCBATCH_CHAR_OFFSET, TCBATCH_CHAR_OFFSET);
+    return _mm_or_si128(_mm_or_si128(head, tail), padding);
+}
+
+__attribute__((target("sse4.2")))
+static inline void __parse_block_sse42(__BatchBlock& block, const __BatchLimits& limits)
+{
+    const __m128i zero_char = _mm_set1_epi8(TCBATCH_CHAR_OFFSET);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i colon = _mm_setr_epi8(0, 0, TCBATCH_COLON_DEFAULT, 0, 0, TCBATCH_COLON_DEFAULT, 0, 0,
+                                        TCBATCH_COLON_DEFAULT, 0, 0, TCBATCH_COLON_SUBFRAMES, 0, 0, 0, 0);
+    const __m128i colon_alt = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, TCBATCH_COLON_DROPFRAME, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i compact = _mm_setr_epi8(0, 1, 3, 4, 6, 7, 9, 10, 12, 13, -1, -1, -1, -1, -1, -1);
+    const __m128i weights = _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 0, 0, 0, 0, 0, 0);
+    const __m128i bounds = _mm_setr_epi16(static_cast<short>(limits.bounds[0]), static_cast<short>(limits.bounds[1]),
+                                          static_cast<short>(limits.bounds[2]), static_cast<short>(limits.bounds[3]),
+                                          static_cast<short>(limits.bounds[4]), 1, 1, 1);
+
+    block.valid = 0;
+    for (std::size_t row = 0; row < TCBATCH_BLOCK_SIZE; ++row) {
+        const __m128i chars = __load_row_sse42(block.fields[row], block.lengths[row]);
+        const __m128i digits = _mm_sub_epi8(chars, zero_char);
+
+        const auto digit_mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(digits, nine), digits)));
+        const auto colon_mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chars, colon),
+                                                                                          _mm_cmpeq_epi8(chars, colon_alt))));
+
+        const __m128i groups = _mm_maddubs_epi16(_mm_shuffle_epi8(digits, compact), weights);
+        const auto bound_mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi16(groups, bounds)));
+
+        const std::uint32_t expected_digits = __batch_expected_digits(block.lengths[row]);
+        const std::uint32_t expected_colons = __batch_expected_colons(block.lengths[row]);
+        const bool valid = expected_digits != 0
+                        && (digit_mask & expected_digits) == expected_digits
+                        && (colon_mask & expected_colons) == expected_colons
+                        && bound_mask == 0xffff;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(block.groups.data() + (row * TCBATCH_TOTAL_GROUPS)), groups);
+
+        block.valid |= static_cast<std::uint32_t>(valid) << row;
+    }
+}
+
+__attribute__((target("avx2")))
+static inline void __parse_block_avx2(__BatchBlock& block, const __BatchLimits& limits)
+{
+    const __m256i zero_char = _mm256_set1_epi8(TCBATCH_CHAR_OFFSET);
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i colon = _mm256_setr_epi8(0, 0, TCBATCH_COLON_DEFAULT, 0, 0, TCBATCH_COLON_DEFAULT, 0, 0,
+                                           TCBATCH_COLON_DEFAULT, 0, 0, TCBATCH_COLON_SUBFRAMES, 0, 0, 0, 0,
+                                           0, 0, TCBATCH_COLON_DEFAULT, 0, 0, TCBATCH_COLON_DEFAULT, 0, 0,
+                                           TCBATCH_COLON_DEFAULT, 0, 0, TCBATCH_COLON_SUBFRAMES, 0, 0, 0, 0);
+    const __m256i colon_alt = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, TCBATCH_COLON_DROPFRAME, 0, 0, 0, 0, 0, 0, 0,
+                                               0, 0, 0, 0, 0, 0, 0, 0, TCBATCH_COLON_DROPFRAME, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i compact = _mm256_setr_epi8(0, 1, 3, 4, 6, 7, 9, 10, 12, 13, -1, -1, -1, -1, -1, -1,
+                                             0, 1, 3, 4, 6, 7, 9, 10, 12, 13, -1, -1, -1, -1, -1, -1);
+    const __m256i weights = _mm256_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 0, 0, 0, 0, 0, 0,
+                                             10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 0, 0, 0, 0, 0, 0);
+    const __m256i bounds = _mm256_setr_epi16(static_cast<short>(limits.bounds[0]), static_cast<short>(limits.bounds[1]),
+                                             static_cast<short>(limits.bounds[2]), static_cast<short>(limits.bounds[3]),
+                                             static_cast<short>(limits.bounds[4]), 1, 1, 1,
+                                             static_cast<short>(limits.bounds[0]), static_cast<short>(limits.bounds[1]),
+                                             static_cast<short>(limits.bounds[2]), static_cast<short>(limits.bounds[3]),
+                                             static_cast<short>(limits.bounds[4]), 1, 1, 1);
+
+    block.valid = 0;
+    for (std::size_t row = 0; row < TCBATCH_BLOCK_SIZE; row += 2) {
+        const __m256i chars = _mm256_inserti128_si256(_mm256_castsi128_si256(__load_row_sse42(block.fields[row], block.lengths[row])),
+                                                      __load_row_sse42(block.fields[row + 1], block.lengths[row + 1]), 1);
+        const __m256i digits = _mm256_sub_epi8(chars, zero_char);
+
+        const auto digit_mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(digits, nine), digits)));
+        const auto colon_mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(chars, colon),
+                                                                                                _mm256_cmpeq_epi8(chars, colon_alt))));
+
+        const __m256i groups = _mm256_maddubs_epi16(_mm256_shuffle_epi8(digits, compact), weights);
+        const auto bound_mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi16(bounds, groups)));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(block.groups.data() + (row * TCBATCH_TOTAL_GROUPS)),
+                         _mm256_castsi256_si128(groups));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(block.groups.data() + ((row + 1) * TCBATCH_TOTAL_GROUPS)),
+                         _mm256_extracti128_si256(groups, 1));
+
+        for (std::size_t half = 0; half < 2; ++half) {
+            const std::size_t shift = half * TCBATCH_FIELD_STRIDE;
+            const std::uint32_t expected_digits = __batch_expected_digits(block.lengths[row + half]) << shift;
+            const std::uint32_t expected_colons = __batch_expected_colons(block.lengths[row + half]) << shift;
+            const std::uint32_t expected_bounds = 0xffffu << shift;
+            const bool valid = expected_digits != 0
+                            && (digit_mask & expected_digits) == expected_digits
+                            && (colon_mask & expected_colons) == expected_colons
+                            && (bound_mask & expected_bounds) == expected_bounds;
+
+            block.valid |= static_cast<std::uint32_t>(valid) << (row + half);
+        }
+    }
+}
+
+#endif // @END OF TCBATCH_HAS_X86_KERNELS
+
+static inline auto __batch_isa_supported(const __BatchIsa isa) -> bool
+{
+    switch (isa) {
+        case __BatchIsa::scalar: return true;
+#if TCBATCH_HAS_X86_KERNELS
+        case __BatchIsa::sse42:  return __builtin_cpu_supports("sse4.2");
+        case __BatchIsa::avx2:   return __builtin_cpu_supports("avx2");
+#else
+        case __BatchIsa::sse42:  return false;
+        case __BatchIsa::avx2:   return false;
+#endif
+    }
+
+    return false;
+}
+
+// the widest kernel the running CPU supports, detected once
+static inline auto __batch_isa_best() -> __BatchIsa
+{
+    static const __BatchIsa best = []() {
+        if (__batch_isa_supported(__BatchIsa::avx2)) return __BatchIsa::avx2;
+        if (__batch_isa_supported(__BatchIsa::sse42)) return __BatchIsa::sse42;
+        return __BatchIsa::scalar;
+    }();
+
+    return best;
+}
+
+static inline void __parse_block(const __BatchIsa isa, __BatchBlock& block, const __BatchLimits& limits)
+{
+#if TCBATCH_HAS_X86_KERNELS
+    if (isa == __BatchIsa::avx2) return __parse_block_avx2(block, limits);
+    if (isa == __BatchIsa::sse42) return __parse_block_sse42(block, limits);
+#endif
+
+    __parse_block_scalar(block, limits);
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Batch Formatter Kernels
+//
+///////////////////////////////////////////////////////////////////////////
+
+// groups of a block of records, hours, minutes, seconds and frames as 16-bit lanes
+struct __FormatBlock
+{
+    alignas(16) std::array<std::uint16_t, TCBATCH_BLOCK_SIZE * TCBATCH_RECORD_GROUPS> groups;
+};
+
+// divisors of a frame count at one rate, built once per batch
+struct __FormatDivisors
+{
+    cxxtc::utility::fast_divisor second;
+    cxxtc::utility::fast_divisor dropframe_cycle;
+    cxxtc::utility::fast_divisor dropframe_minute;
+    bool drop_frame;
+};
+
+static constexpr auto __init_digit_pairs() -> std::array<char, TCBATCH_DIGIT_PAIRS * 2>
+{
+    std::array<char, TCBATCH_DIGIT_PAIRS * 2> pairs{};
+    for (std::size_t i = 0; i < TCBATCH_DIGIT_PAIRS; ++i) {
+        pairs[i * 2] = static_cast<char>(TCBATCH_CHAR_OFFSET + (i / 10));
+        pairs[(i * 2) + 1] = static_cast<char>(TCBATCH_CHAR_OFFSET + (i % 10));
+    }
+
+    return pairs;
+}
+
+// the two chars of every group value, so a group is written with one 2-byte copy
+static constexpr std::array<char, TCBATCH_DIGIT_PAIRS * 2> __batch_digit_pairs = __init_digit_pairs();
+
+static inline auto __init_format_divisors(const std::uint64_t timebase, const bool drop_frame) -> __FormatDivisors
+{
+    const std::uint64_t dropped = (drop_frame) ? timebase / TCBATCH_DROPFRAME_DIVISOR : 0;
+    const std::uint64_t frames_per_minute = (timebase * TCBATCH_SECS_PER_MIN) - dropped;
+    const std::uint64_t frames_per_cycle = (frames_per_minute * TCBATCH_DROPFRAME_MINS_CYCLE) + dropped;
+
+    return __FormatDivisors {
+        cxxtc::utility::fast_divisor(timebase),
+        cxxtc::utility::fast_divisor(frames_per_cycle),
+        cxxtc::utility::fast_divisor(frames_per_minute),
+        drop_frame
+    };
+}
+
+// splits a frame count into the groups of its label, hours wrap at 100 like the
+// string conversion of a single timecode. Only the timebase is a run-time divisor,
+// the seconds are split with constant divisors.
+static inline void __split_record(const std::uint64_t frames, const __FormatDivisors& divisors, std::uint16_t* groups)
+{
+    const std::uint64_t label = (divisors.drop_frame)
+        ? __dropframe_to_label(frames, divisors.second.divisor,
+                               [&](const std::uint64_t n) { return divisors.dropframe_cycle.divide(n); },
+                               [&](const std::uint64_t n) { return divisors.dropframe_minute.divide(n); })
+        : frames;
+
+    const std::uint64_t total_seconds = divisors.second.divide(label);
+    const std::uint64_t total_minutes = total_seconds / TCBATCH_SECS_PER_MIN;
+
+    groups[0] = static_cast<std::uint16_t>((total_minutes / TCBATCH_MINS_PER_HR) % TCBATCH_DIGIT_PAIRS);
+    groups[1] = static_cast<std::uint16_t>(total_minutes % TCBATCH_MINS_PER_HR);
+    groups[2] = static_cast<std::uint16_t>(total_seconds % TCBATCH_SECS_PER_MIN);
+    groups[3] = static_cast<std::uint16_t>(label - (total_seconds * divisors.second.divisor));
+}
+
+static inline void __format_block_scalar(const __FormatBlock& block, const std::size_t rows,
+                                         const char frames_colon, char* out, const std::size_t stride)
+{
+    for (std::size_t row = 0; row < rows; ++row) {
+        const std::uint16_t* groups = block.groups.data() + (row * TCBATCH_RECORD_GROUPS);
+        char* record = out + (row * stride);
+
+        for (std::size_t group = 0; group < TCBATCH_RECORD_GROUPS; ++group) {
+            std::memcpy(record + (group * 3), __batch_digit_pairs.data() + (groups[group] * 2), 2);
+        }
+
+        record[2] = TCBATCH_COLON_DEFAULT;
+        record[5] = TCBATCH_COLON_DEFAULT;
+        record[TCBATCH_SIZE_STANDARD - 3] = frames_colon;
+    }
+}
+
+#if TCBATCH_HAS_X86_KERNELS
+
+__attribute__((target("sse4.2")))
+static inline void __store_record_sse42(char* record, const __m128i chars)
+{
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(record), chars);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(record + TCBATCH_SIZE_STANDARD - 8), _mm_srli_si128(chars, TCBATCH_SIZE_STANDARD - 8));
+}
+
+// Two records per register: tens are the high half of value * 6554 (exact below
+// 100), ones the rest, and a shuffle spreads each record's eight digits around
+// its separators. The 11 chars are written as two overlapping 8-byte stores so
+// nothing past a record is touched.
+__attribute__((target("sse4.2")))
+static inline void __format_block_sse42(const __FormatBlock& block, const std::size_t rows,
+                                        const char frames_colon, char* out, const std::size_t stride)
+{
+    const __m128i tenth = _mm_set1_epi16(6554);
+    const __m128i ten = _mm_set1_epi16(10);
+    const __m128i zero_chars = _mm_set1_epi8(TCBATCH_CHAR_OFFSET);
+    const __m128i spread_first = _mm_setr_epi8(0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1, -1, -1, -1, -1);
+    const __m128i spread_second = _mm_setr_epi8(8, 9, -1, 10, 11, -1, 12, 13, -1, 14, 15, -1, -1, -1, -1, -1);
+    const __m128i separators = _mm_setr_epi8(0, 0, TCBATCH_COLON_DEFAULT, 0, 0, TCBATCH_COLON_DEFAULT, 0, 0, frames_colon,
+                                             0, 0, 0, 0, 0, 0, 0);
+
+    for (std::size_t row = 0; row < rows; row += 2) {
+        const __m128i values = _mm_load_si128(reinterpret_cast<const __m128i*>(block.groups.data() + (row * TCBATCH_RECORD_GROUPS)));
+        const __m128i tens = _mm_mulhi_epu16(values, tenth);
+        const __m128i ones = _mm_sub_epi16(values, _mm_mullo_epi16(tens, ten));
+        const __m128i digits = _mm_add_epi8(_mm_or_si128(tens, _mm_slli_epi16(ones, 8)), zero_chars);
+
+        __store_record_sse42(out + (row * stride), _mm_or_si128(_mm_shuffle_epi8(digits, spread_first), separators));
+        if (row + 1 < rows) {
+            __store_record_sse42(out + ((row + 1) * stride), _mm_or_si128(_mm_shuffle_epi8(digits, spread_second), separators));
+        }
+    }
+}
+
+#endif // @END OF TCBATCH_HAS_X86_KERNELS
+
+// AVX2 has no wider shuffle across its two halves, so it shares the SSE4.2 kernel
+static inline void __format_block(const __BatchIsa isa, const __FormatBlock& block, const std::size_t rows,
+                                  const char frames_colon, char* out, const std::size_t stride)
+{
+#if TCBATCH_HAS_X86_KERNELS
+    if (isa == __BatchIsa::avx2 || isa == __BatchIsa::sse42) return __format_block_sse42(block, rows, frames_colon, out, stride);
+#endif
+
+    __format_block_scalar(block, rows, frames_colon, out, stride);
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Batch Parser
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Parses count fields, where field(i) returns the i-th string view, into tick
+// counts at the given rate and sets bit i % 64 of valid[i / 64] for each field
+// that is a well-formed label of that rate. Invalid fields get zero ticks.
+// Returns the number of valid fields.
+template<FpsFormatFactory TFps, typename TField>
+static auto __parse_batch(const __BatchIsa isa,
+                          const std::size_t count,
+                          TField field,
+                          const typename TFps::type fps,
+                          std::span<std::uint64_t> ticks,
+                          std::span<std::uint64_t> valid) -> std::size_t
+{
+    assert(ticks.size() >= count && "span of ticks passed to batch parser is smaller than the number of fields");
+    assert(valid.size() * 64 >= count && "span of validity words passed to batch parser is smaller than the number of fields");
+    assert(__batch_isa_supported(isa) && "instruction set passed to batch parser is not supported by this CPU");
+
+    const auto timebase = static_cast<std::uint64_t>(TFps::to_timebase(fps));
+    const bool drop_frame = TFps::is_drop_frame(fps);
+    const std::uint64_t dropped = (drop_frame) ? timebase / TCBATCH_DROPFRAME_DIVISOR : 0;
+
+    const __BatchLimits limits{ { 100, TCBATCH_MINS_PER_HR, TCBATCH_SECS_PER_MIN, static_cast<std::uint16_t>(timebase), TCBATCH_SUBFRAMES_PER_FRAMES } };
+
+    std::fill_n(valid.begin(), (count + 63) / 64, std::uint64_t{0});
+
+    std::size_t total_valid = 0;
+    __BatchBlock block;
+    for (std::size_t first = 0; first < count; first += TCBATCH_BLOCK_SIZE) {
+        const std::size_t rows = std::min<std::size_t>(TCBATCH_BLOCK_SIZE, count - first);
+
+        block.fields.fill(__batch_placeholder);
+        block.lengths.fill(0);
+        for (std::size_t row = 0; row < rows; ++row) {
+            const std::string_view view = field(first + row);
+            if (view.length() != TCBATCH_SIZE_STANDARD && view.length() != TCBATCH_SIZE_WITH_SUBFRAMES) continue;
+
+            block.fields[row] = view.data();
+            block.lengths[row] = static_cast<std::uint8_t>(view.length());
+        }
+
+        __parse_block(isa, block, limits);
+
+        for (std::size_t row = 0; row < rows; ++row) {
+            const std::uint16_t* groups = block.groups.data() + (row * TCBATCH_TOTAL_GROUPS);
+            const std::uint64_t total_minutes = (std::uint64_t{groups[0]} * TCBATCH_MINS_PER_HR) + groups[1];
+            const std::uint64_t label = (((total_minutes * TCBATCH_SECS_PER_MIN) + groups[2]) * timebase) + groups[3];
+
+            // drop-frame counting skips the first labels of most minutes
+            const bool skipped = groups[2] == 0 && groups[1] % TCBATCH_DROPFRAME_MINS_CYCLE != 0 && groups[3] < dropped;
+            const bool is_valid = ((block.valid >> row) & 1) && !skipped;
+
+            const std::uint64_t frames = (drop_frame) ? __dropframe_from_label(label, timebase, total_minutes) : label;
+            ticks[first + row] = (is_valid) ? (frames * TCBATCH_SUBFRAMES_PER_FRAMES) + groups[4] : 0;
+
+            valid[(first + row) / 64] |= std::uint64_t{is_valid} << ((first + row) % 64);
+            total_valid += is_valid;
+        }
+    }
+
+    return total_valid;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Batch Formatter
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Writes count fixed-width HH:MM:SS:FF records, where frames(i) returns the i-th
+// frame count, starting every stride chars of out. Drop-frame rates separate the
+// frames with ';'. Chars between records are left untouched.
+template<FpsFormatFactory TFps, typename TFrames>
+static void __format_batch(const __BatchIsa isa,
+                           const std::size_t count,
+                           TFrames frames,
+                           const typename TFps::type fps,
+                           std::span<char> out,
+                           const std::size_t stride)
+{
+    assert(stride >= TCBATCH_SIZE_STANDARD && "stride passed to batch formatter is shorter than a record");
+    assert((count == 0 || out.size() >= ((count - 1) * stride) + TCBATCH_SIZE_STANDARD)
+           && "span of chars passed to batch formatter is smaller than the records");
+    assert(__batch_isa_supported(isa) && "instruction set passed to batch formatter is not supported by this CPU");
+
+    const auto timebase = std::max<std::uint64_t>(static_cast<std::uint64_t>(TFps::to_timebase(fps)), 1);
+    const bool drop_frame = TFps::is_drop_frame(fps);
+    const __FormatDivisors divisors = __init_format_divisors(timebase, drop_frame);
+    const char frames_colon = (drop_frame) ? TCBATCH_COLON_DROPFRAME : TCBATCH_COLON_DEFAULT;
+
+    __FormatBlock block{};
+    for (std::size_t first = 0; first < count; first += TCBATCH_BLOCK_SIZE) {
+        const std::size_t rows = std::min<std::size_t>(TCBATCH_BLOCK_SIZE, count - first);
+
+        for (std::size_t row = 0; row < rows; ++row) {
+            __split_record(frames(first + row), divisors, block.groups.data() + (row * TCBATCH_RECORD_GROUPS));
+        }
+
+        __format_block(isa, block, rows, frames_colon, out.data() + (first * stride), stride);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+#undef TCBATCH_BLOCK_SIZE
+#undef TCBATCH_FIELD_STRIDE
+#undef TCBATCH_TOTAL_GROUPS
+#undef TCBATCH_RECORD_GROUPS
+#undef TCBATCH_DIGIT_PAIRS
+#undef TCBATCH_SIZE_STANDARD
+#undef TCBATCH_SIZE_WITH_SUBFRAMES
+#undef TCBATCH_CHAR_OFFSET
+#undef TCBATCH_COLON_DEFAULT
+#undef TCBATCH_COLON_DROPFRAME
+#undef TCBATCH_COLON_SUBFRAMES
+#undef TCBATCH_SUBFRAMES_PER_FRAMES
+#undef TCBATCH_SECS_PER_MIN
+#undef TCBATCH_MINS_PER_HR
+#undef TCBATCH_DROPFRAME_DIVISOR
+#undef TCBATCH_DROPFRAME_MINS_CYCLE
+#undef TCBATCH_DIGITS_STANDARD
+#undef TCBATCH_DIGITS_WITH_SUBFRAMES
+#undef TCBATCH_COLONS_STANDARD
+#undef TCBATCH_COLONS_WITH_SUBFRAMES
+
+} // @END OF namespace cxxtc::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,247 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Parsing and formatting timecodes in wchar_t, char8_t, char16_t and char32_t
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+// Library headers
+#include "timecode_basic.hpp"
+#include "timecode_common.hpp"
+#include "traits.hpp"
+#include "utility.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+#ifndef VTM_TIMECODE_CHARS_MACROS
+#define VTM_TIMECODE_CHARS_MACROS
+
+// SSE2 is part of the x86-64 baseline, so the kernels need no run-time dispatch
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#define TCCHARS_HAS_SSE2 1
+#include <emmintrin.h>
+#else
+#define TCCHARS_HAS_SSE2 0
+#endif
+
+#endif // @END OF VTM_TIMECODE_CHARS_MACROS
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace cxxtc::chrono::internal {
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Chars Static Config --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#define TCCHARS_SIZE_LABEL_MAX 14
+#define TCCHARS_SIZE_BUFFER 24
+#define TCCHARS_ASCII_MAX 0x7f
+#define TCCHARS_NOT_ASCII '\xff'
+#define TCCHARS_VECTOR_UNITS 8
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Code Unit Narrowing and Widening
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Labels are ASCII in every encoding, so other char types are narrowed to char
+// for the SWAR parser and the output of to_chars is widened. Units past ASCII
+// narrow to 0xff, which no label accepts, so a narrowed label is valid exactly
+// when the original is.
+template<cxxtc::traits::WideCharType TChar>
+static constexpr auto __narrow_unit(const TChar c) noexcept -> char
+{
+    const auto unit = static_cast<std::make_unsigned_t<TChar>>(c);
+    return (unit <= TCCHARS_ASCII_MAX) ? static_cast<char>(unit) : TCCHARS_NOT_ASCII;
+}
+
+#if TCCHARS_HAS_SSE2
+// Eight units of the head and eight of the tail are packed to bytes with
+// saturation, two overlapping stores cover any length from 8 to 16. Saturation
+// sends units past 0xff to 0xff and units with the sign bit set to 0, neither
+// of which a label accepts.
+template<cxxtc::traits::WideCharType TChar>
+static inline void __narrow_units_sse2(const TChar* in, const std::size_t length, char* out)
+{
+    const auto load = [](const TChar* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); };
+    const TChar* tail = in + length - TCCHARS_VECTOR_UNITS;
+
+    __m128i packed;
+    if constexpr (sizeof(TChar) == 2) {
+        packed = _mm_packus_epi16(load(in), load(tail));
+    }
+
+    else {
+        packed = _mm_packus_epi16(_mm_packs_epi32(load(in), load(in + 4)),
+                                  _mm_packs_epi32(load(tail), load(tail + 4)));
+    }
+
+    // 0x80 to 0xff survive saturation, send them to 0xff like the scalar path
+    const __m128i ascii = _mm_cmplt_epi8(packed, _mm_setzero_si128());
+    packed = _mm_or_si128(packed, ascii);
+
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + length - TCCHARS_VECTOR_UNITS), _mm_srli_si128(packed, 8));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), packed);
+}
+
+// eight bytes of the head and eight of the tail interleaved with zeros
+template<cxxtc::traits::WideCharType TChar>
+static inline void __widen_units_sse2(const char* in, const std::size_t length, TChar* out)
+{
+    const auto store = [](TChar* p, const __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); };
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i head = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in)), zero);
+    const __m128i tail = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + length - TCCHARS_VECTOR_UNITS)), zero);
+    TChar* out_tail = out + length - TCCHARS_VECTOR_UNITS;
+
+    if constexpr (sizeof(TChar) == 2) {
+        store(out_tail, tail);
+        store(out, head);
+    }
+
+    else {
+        store(out_tail, _mm_unpacklo_epi16(tail, zero));
+        store(out_tail + 4, _mm_unpackhi_epi16(tail, zero));
+        store(out, _mm_unpacklo_epi16(head, zero));
+        store(out + 4, _mm_unpackhi_epi16(head, zero));
+    }
+}
+#endif // @END OF TCCHARS_HAS_SSE2
+
+template<cxxtc::traits::WideCharType TChar>
+static constexpr void __narrow_units(const TChar* in, const std::size_t length, char* out)
+{
+    if (!std::is_constant_evaluated()) {
+        if constexpr (sizeof(TChar) == 1) {
+            std::memcpy(out, in, length);
+            return;
+        }
+
+#if TCCHARS_HAS_SSE2
+        else {
+            if (length >= TCCHARS_VECTOR_UNITS && length <= 2 * TCCHARS_VECTOR_UNITS) {
+                __narrow_units_sse2(in, length, out);
+                return;
+            }
+        }
+#endif
+    }
+
+    for (std::size_t i = 0; i < length; ++i) out[i] = __narrow_unit(in[i]);
+}
+
+template<cxxtc::traits::WideCharType TChar>
+static constexpr void __widen_units(const char* in, const std::size_t length, TChar* out)
+{
+    if (!std::is_constant_evaluated()) {
+        if constexpr (sizeof(TChar) == 1) {
+            std::memcpy(out, in, length);
+            return;
+        }
+
+#if TCCHARS_HAS_SSE2
+        else {
+            if (length >= TCCHARS_VECTOR_UNITS && length <= 2 * TCCHARS_VECTOR_UNITS) {
+                __widen_units_sse2(in, length, out);
+                return;
+            }
+        }
+#endif
+    }
+
+    for (std::size_t i = 0; i < length; ++i) out[i] = static_cast<TChar>(static_cast<unsigned char>(in[i]));
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Wide Parsing and Formatting
+//
+///////////////////////////////////////////////////////////////////////////
+
+// std::to_chars_result and std::from_chars_result for other char types
+template<cxxtc::traits::WideCharType TChar>
+struct __ToCharsResult
+{
+    TChar* ptr = nullptr;
+    std::errc ec{};
+
+    friend constexpr bool operator==(const __ToCharsResult&, const __ToCharsResult&) = default;
+};
+
+template<cxxtc::traits::WideCharType TChar>
+struct __FromCharsResult
+{
+    const TChar* ptr = nullptr;
+    std::errc ec{};
+
+    friend constexpr bool operator==(const __FromCharsResult&, const __FromCharsResult&) = default;
+};
+
+template<typename TTimecode, cxxtc::traits::WideCharType TChar>
+static constexpr auto __parse_chars(const std::basic_string_view<TChar> tc, const typename TTimecode::fps_scalar_t fps) noexcept
+    -> cxxtc::utility::expected<TTimecode, __ParseError>
+{
+    if (tc.length() > TCCHARS_SIZE_LABEL_MAX) return cxxtc::utility::unexpected<__ParseError>{ __ParseError::invalid_length };
+
+    char label[TCCHARS_SIZE_LABEL_MAX]{};
+    __narrow_units(tc.data(), tc.length(), label);
+    return TTimecode::parse(std::string_view{ label, tc.length() }, fps);
+}
+
+template<typename TTimecode, cxxtc::traits::WideCharType TChar>
+static inline auto __to_chars(TChar* first, TChar* last, const TTimecode& tc, const __CharsFormat format) -> __ToCharsResult<TChar>
+{
+    char buffer[TCCHARS_SIZE_BUFFER];
+    const std::to_chars_result result = tc.to_chars(buffer, buffer + sizeof(buffer), format);
+    const auto length = static_cast<std::size_t>(result.ptr - buffer);
+
+    if (static_cast<std::size_t>(last - first) < length) return { last, std::errc::value_too_large };
+
+    __widen_units(buffer, length, first);
+    return { first + length, std::errc{} };
+}
+
+template<typename TTimecode, cxxtc::traits::WideCharType TChar>
+static inline auto __from_chars(const TChar* first, const TChar* last, TTimecode& tc) -> __FromCharsResult<TChar>
+{
+    const std::size_t length = std::min(static_cast<std::size_t>(last - first), std::size_t{ TCCHARS_SIZE_LABEL_MAX });
+
+    char label[TCCHARS_SIZE_LABEL_MAX]{};
+    __narrow_units(first, length, label);
+
+    const std::from_chars_result result = TTimecode::from_chars(label, label + length, tc);
+    return { first + (result.ptr - label), result.ec };
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+#undef TCCHARS_SIZE_LABEL_MAX
+#undef TCCHARS_SIZE_BUFFER
+#undef TCCHARS_ASCII_MAX
+#undef TCCHARS_NOT_ASCII
+#undef TCCHARS_VECTOR_UNITS
+
+} // @END OF namespace cxxtc::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
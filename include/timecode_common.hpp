@@ -8,11 +8,14 @@
 ///////////////////////////////////////////////////////////////////////////
 
 // Standard headers
+#include <algorithm>
 #include <concepts>
 #include <cstdint>
+#include <limits>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 
 // Library headers
 #include "errors.hpp"
@@ -28,68 +31,140 @@
 
 #endif // @END OF VTM_TIMECODE_CFG_MACROS
 
-#define __FPS_TYPE() cxxtc::chrono::internal::__FPSFormat<cxxtc::chrono::float64_t, cxxtc::chrono::int64_t>::type
-
-// TODO: These aren't guaranteed to return the value you expect. It may short-circuit on duplicate values
-#define __FPSFORMAT_VALUE_TO_STRING(in) GET_ENUM_MAPPING_1(__FPSFORMAT_STRING(), in)
-#define __FPSFORMAT_STRING_TO_VALUE(in) GET_ENUM_MAPPING_2(__FPSFORMAT_STRING(), in)
-#define __FPSFORMAT_STRING() DECLARE_ENUM_MAPPING(__FPS_TYPE(),                            \
-                                                  std::string_view,                        \
-                                                  [](){ VTM_WARN("unknown fps format"); }, \
-                                                  [](){ VTM_WARN("unknown fps format"); }, \
-                                                  __FPS_TYPE()::none,                      \
-                                                  "NONE",                                  \
-                                                  "24 fps",                                \
-                                                  "25 fps",                                \
-                                                  "30 fps",                                \
-                                                  "29.97 fps",                             \
-                                                  "29.97 fps drop-frame",                  \
-                                                  "60 fps")
-
-#define __FPSFORMAT_VALUE_TO_INT(in) GET_ENUM_MAPPING_1(__FPSFORMAT_INT(), in)
-#define __FPSFORMAT_INT_TO_VALUE(in) GET_ENUM_MAPPING_2(__FPSFORMAT_INT(), in)
-#define __FPSFORMAT_INT() DECLARE_ENUM_MAPPING(__FPS_TYPE(),                            \
-                                               cxxtc::chrono::int64_t,                    \
-                                               [](){ VTM_WARN("unknown fps format"); }, \
-                                               [](){ VTM_WARN("unknown fps format"); }, \
-                                               __FPS_TYPE()::none,                      \
-                                               0,                                       \
-                                               24,                                      \
-                                               25,                                      \
-                                               30,                                      \
-                                               29,                                      \
-                                               -29,                                     \
-                                               60)
-
-#define __FPSFORMAT_VALUE_TO_FLOAT(in) GET_ENUM_MAPPING_1(__FPSFORMAT_FLOAT(), in)
-#define __FPSFORMAT_FLOAT_TO_VALUE(in) GET_ENUM_MAPPING_2(__FPSFORMAT_FLOAT(), in)
-#define __FPSFORMAT_FLOAT() DECLARE_ENUM_MAPPING(__FPS_TYPE(),                            \
-                                                 cxxtc::chrono::float64_t,                  \
-                                                 [](){ VTM_WARN("unknown fps format"); }, \
-                                                 [](){ VTM_WARN("unknown fps format"); }, \
-                                                 __FPS_TYPE()::none,                      \
-                                                 0.0,                                     \
-                                                 24.0,                                    \
-                                                 25.0,                                    \
-                                                 30.0,                                    \
-                                                 29.97,                                   \
-                                                 -29.97,                                  \
-                                                 60.0)
-
-#define __FPSFORMAT_VALUE_TO_DROPFRAME(in) GET_ENUM_MAPPING_1(__FPSFORMAT_DROPFRAME(), in)
-#define __FPSFORMAT_DROPFRAME_TO_VALUE(in) GET_ENUM_MAPPING_2(__FPSFORMAT_DROPFRAME(), in)
-#define __FPSFORMAT_DROPFRAME() DECLARE_ENUM_MAPPING(__FPS_TYPE(),                         \
-                                                  bool,                                    \
-                                                  [](){ VTM_WARN("unknown fps format"); }, \
-                                                  [](){ VTM_WARN("unknown fps format"); }, \
-                                                  __FPS_TYPE()::none,                      \
-                                                  false,                                   \
-                                                  false,                                   \
-                                                  false,                                   \
-                                                  false,                                   \
-                                                  false,                                   \
-                                                  true,                                    \
-                                                  false)
+// Mappings are built once per __FPSFormat as static tables: values are read by indexing
+// with the format and formats are found from values through a perfect hash. Duplicate
+// values (e.g. timebases) map back to the first format that declares them.
+#define __FPSFORMAT_VALUE_TO_STRING(in) GET_ENUM_MAPPING_1(__my_type::__string_mapping, in)
+#define __FPSFORMAT_STRING_TO_VALUE(in) GET_ENUM_MAPPING_2(__my_type::__string_mapping, in)
+#define __FPSFORMAT_STRING(T) DECLARE_ENUM_MAPPING(T,                      \
+                                                   std::string_view,       \
+                                                   T::none,                \
+                                                   "NONE",                 \
+                                                   "24 fps",               \
+                                                   "25 fps",               \
+                                                   "30 fps",               \
+                                                   "29.97 fps",            \
+                                                   "29.97 fps drop-frame", \
+                                                   "60 fps",               \
+                                                   "59.94 fps",            \
+                                                   "59.94 fps drop-frame", \
+                                                   "23.976 fps",           \
+                                                   "48 fps",               \
+                                                   "50 fps",               \
+                                                   "100 fps")
+
+#define __FPSFORMAT_VALUE_TO_INT(in) GET_ENUM_MAPPING_1(__my_type::__int_mapping, in)
+#define __FPSFORMAT_INT_TO_VALUE(in) GET_ENUM_MAPPING_2(__my_type::__int_mapping, in)
+#define __FPSFORMAT_INT(T) DECLARE_ENUM_MAPPING(T,                      \
+                                                cxxtc::chrono::int64_t, \
+                                                T::none,                \
+                                                0,                      \
+                                                24,                     \
+                                                25,                     \
+                                                30,                     \
+                                                29,                     \
+                                                -29,                    \
+                                                60,                     \
+                                                59,                     \
+                                                -59,                    \
+                                                23,                     \
+                                                48,                     \
+                                                50,                     \
+                                                100)
+
+#define __FPSFORMAT_VALUE_TO_FLOAT(in) GET_ENUM_MAPPING_1(__my_type::__float_mapping, in)
+#define __FPSFORMAT_FLOAT_TO_VALUE(in) GET_ENUM_MAPPING_2(__my_type::__float_mapping, in)
+#define __FPSFORMAT_FLOAT(T) DECLARE_ENUM_MAPPING(T,                        \
+                                                  cxxtc::chrono::float64_t, \
+                                                  T::none,                  \
+                                                  0.0,                      \
+                                                  24.0,                     \
+                                                  25.0,                     \
+                                                  30.0,                     \
+                                                  29.97,                    \
+                                                  -29.97,                   \
+                                                  60.0,                     \
+                                                  59.94,                    \
+                                                  -59.94,                   \
+                                                  23.976,                   \
+                                                  48.0,                     \
+                                                  50.0,                     \
+                                                  100.0)
+
+#define __FPSFORMAT_VALUE_TO_DROPFRAME(in) GET_ENUM_MAPPING_1(__my_type::__dropframe_mapping, in)
+#define __FPSFORMAT_DROPFRAME_TO_VALUE(in) GET_ENUM_MAPPING_2(__my_type::__dropframe_mapping, in)
+#define __FPSFORMAT_DROPFRAME(T) DECLARE_ENUM_MAPPING(T,       \
+                                                      bool,    \
+                                                      T::none, \
+                                                      false,   \
+                                                      false,   \
+                                                      false,   \
+                                                      false,   \
+                                                      false,   \
+                                                      true,    \
+                                                      false,   \
+                                                      false,   \
+                                                      true,    \
+                                                      false,   \
+                                                      false,   \
+                                                      false,   \
+                                                      false)
+
+// frames counted per timecode second, which is the rounded-up rate for NTSC rates
+#define __FPSFORMAT_VALUE_TO_TIMEBASE(in) GET_ENUM_MAPPING_1(__my_type::__timebase_mapping, in)
+#define __FPSFORMAT_TIMEBASE(T) DECLARE_ENUM_MAPPING(T,                       \
+                                                     cxxtc::chrono::uint64_t, \
+                                                     T::none,                 \
+                                                     0ULL,                    \
+                                                     24ULL,                   \
+                                                     25ULL,                   \
+                                                     30ULL,                   \
+                                                     30ULL,                   \
+                                                     30ULL,                   \
+                                                     60ULL,                   \
+                                                     60ULL,                   \
+                                                     60ULL,                   \
+                                                     24ULL,                   \
+                                                     48ULL,                   \
+                                                     50ULL,                   \
+                                                     100ULL)
+
+// exact frame rates as numerator / denominator, NTSC rates are N * 1000 / 1001
+#define __FPSFORMAT_VALUE_TO_NUMERATOR(in) GET_ENUM_MAPPING_1(__my_type::__numerator_mapping, in)
+#define __FPSFORMAT_NUMERATOR(T) DECLARE_ENUM_MAPPING(T,                       \
+                                                      cxxtc::chrono::uint64_t, \
+                                                      T::none,                 \
+                                                      0ULL,                    \
+                                                      24ULL,                   \
+                                                      25ULL,                   \
+                                                      30ULL,                   \
+                                                      30000ULL,                \
+                                                      30000ULL,                \
+                                                      60ULL,                   \
+                                                      60000ULL,                \
+                                                      60000ULL,                \
+                                                      24000ULL,                \
+                                                      48ULL,                   \
+                                                      50ULL,                   \
+                                                      100ULL)
+
+#define __FPSFORMAT_VALUE_TO_DENOMINATOR(in) GET_ENUM_MAPPING_1(__my_type::__denominator_mapping, in)
+#define __FPSFORMAT_DENOMINATOR(T) DECLARE_ENUM_MAPPING(T,                       \
+                                                        cxxtc::chrono::uint64_t, \
+                                                        T::none,                 \
+                                                        1ULL,                    \
+                                                        1ULL,                    \
+                                                        1ULL,                    \
+                                                        1ULL,                    \
+                                                        1001ULL,                 \
+                                                        1001ULL,                 \
+                                                        1ULL,                    \
+                                                        1001ULL,                 \
+                                                        1001ULL,                 \
+                                                        1001ULL,                 \
+                                                        1ULL,                    \
+                                                        1ULL,                    \
+                                                        1ULL)
 
 #endif // @END OF VTM_TIMECODE_CFG_MACROS
 
@@ -146,6 +221,27 @@ namespace cxxtc::chrono::internal {
 template<typename T>
 concept TimecodePrimitive = std::floating_point<T> || std::integral<T>;
 
+// @SECTION: Rational Frame Rate
+// Exact frame rate in frames per second, e.g. 30000 / 1001 for 29.97.
+template<std::unsigned_integral T>
+struct __FPSRational
+{
+    using value_type = T;
+
+    value_type numerator = 0;
+    value_type denominator = 1;
+
+    constexpr auto operator==(const __FPSRational&) const -> bool = default;
+};
+
+template<typename T>
+concept FpsRational = requires (T r) {
+                          { r.numerator } -> std::convertible_to<std::uint64_t>;
+                          { r.denominator } -> std::convertible_to<std::uint64_t>;
+                          requires std::unsigned_integral<std::remove_cvref_t<decltype(r.numerator)>>;
+                          requires std::unsigned_integral<std::remove_cvref_t<decltype(r.denominator)>>;
+                      };
+
 // @SECTION: Default FPS Format Template
 template<typename T>
 concept FpsFormatFactory = std::is_enum_v<typename T::format>
@@ -160,6 +256,9 @@ concept FpsFormatFactory = std::is_enum_v<typename T::format>
                                { T::from_string(std::string("")) } -> std::same_as<typename T::type>;
                                { T::to_signed(type) } -> std::signed_integral;
                                { T::to_unsigned(type) } -> std::unsigned_integral;
+                               { T::to_timebase(type) } -> std::unsigned_integral;
+                               { T::is_drop_frame(type) } -> std::same_as<bool>;
+                               { T::to_rational(type) } -> FpsRational;
                                { T::to_float(type) } -> std::floating_point;
                                { T::to_string(type) } -> cxxtc::traits::StringLike;
                            };
@@ -176,6 +275,12 @@ struct __FPSFormat
         fps_29p97,
         fpsdf_29p97,
         fps_60,
+        fps_59p94,
+        fpsdf_59p94,
+        fps_23p976,
+        fps_48,
+        fps_50,
+        fps_100,
         none
     };
 
@@ -184,7 +289,18 @@ struct __FPSFormat
     using float_type = TFloat;
     using signed_type = cxxtc::traits::to_signed_t<TInt>;
     using unsigned_type = cxxtc::traits::to_unsigned_t<TInt>;
-
+    using rational_type = __FPSRational<unsigned_type>;
+
+private:
+    static constexpr auto __string_mapping      = __FPSFORMAT_STRING(format);
+    static constexpr auto __int_mapping         = __FPSFORMAT_INT(format);
+    static constexpr auto __float_mapping       = __FPSFORMAT_FLOAT(format);
+    static constexpr auto __dropframe_mapping   = __FPSFORMAT_DROPFRAME(format);
+    static constexpr auto __timebase_mapping    = __FPSFORMAT_TIMEBASE(format);
+    static constexpr auto __numerator_mapping   = __FPSFORMAT_NUMERATOR(format);
+    static constexpr auto __denominator_mapping = __FPSFORMAT_DENOMINATOR(format);
+
+public:
     static constexpr auto default_value() -> type
     {
         return __FPSFORMAT_INT_TO_VALUE(VTM_TIMECODE_FPS_DEFAULT);
@@ -220,6 +336,17 @@ struct __FPSFormat
         return std::abs(__FPSFORMAT_VALUE_TO_INT(t));
     }
 
+    static constexpr auto to_timebase(const type& t) -> unsigned_type
+    {
+        return __FPSFORMAT_VALUE_TO_TIMEBASE(t);
+    }
+
+    static constexpr auto to_rational(const type& t) -> rational_type
+    {
+        return rational_type{ static_cast<unsigned_type>(__FPSFORMAT_VALUE_TO_NUMERATOR(t)),
+                              static_cast<unsigned_type>(__FPSFORMAT_VALUE_TO_DENOMINATOR(t)) };
+    }
+
     static constexpr std::floating_point
     auto to_float(const type& t)
     {
@@ -233,6 +360,244 @@ struct __FPSFormat
     }
 };
 
+// @SECTION: Compile-time FPS Format Template
+// Fixes the rate as a template parameter so every factor derived from it is a
+// compile-time constant. Rate is either a format value or an integral fps that
+// from_int() understands (e.g. 25, or -29 for 29.97 drop-frame).
+template<auto Rate, std::floating_point TFloat, std::integral TInt>
+struct __FPSConstant : public __FPSFormat<TFloat, TInt>
+{
+    using __base_type = __FPSFormat<TFloat, TInt>;
+    using __my_type = __FPSConstant<Rate, TFloat, TInt>;
+    using type = typename __base_type::type;
+
+    static constexpr type value = []() -> type {
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(Rate)>, type>) return Rate;
+        else return __base_type::from_int(Rate);
+    }();
+
+    static_assert(value != type::none, "rate of __FPSConstant must be a known fps format");
+
+    static constexpr auto default_value() -> type
+    {
+        return value;
+    }
+};
+
+template<typename T>
+concept ConstantFpsFormat = FpsFormatFactory<T>
+                         && requires {
+                                { T::value } -> std::convertible_to<typename T::type>;
+                            };
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//                    @SECTION Arithmetic Policies
+//
+///////////////////////////////////////////////////////////////////////////
+
+// A policy decides what timecode arithmetic does when a result leaves the range of
+// the tick count. Each operation gets the current ticks, the operand, the length of
+// a 24-hour day in ticks at the timecode's rate and an error flag it may raise.
+// narrow() then fits the 64-bit result into the tick count, whose largest value
+// is one less than a power of two.
+
+// @SECTION: Unchecked Arithmetic
+// Plain modular arithmetic on the tick count, with no checks at all.
+struct __ArithmeticUnchecked
+{
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto add(const T a, const U b, const cxxtc::utility::fast_divisor&, bool&) noexcept -> T
+    {
+        return a + static_cast<T>(b);
+    }
+
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto sub(const T a, const U b, const cxxtc::utility::fast_divisor&, bool&) noexcept -> T
+    {
+        return a - static_cast<T>(b);
+    }
+
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto mul(const T a, const U b, const cxxtc::utility::fast_divisor&, bool&) noexcept -> T
+    {
+        return a * static_cast<T>(b);
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr auto narrow(const T value, const T max, bool&) noexcept -> T
+    {
+        return value & max;
+    }
+};
+
+// @SECTION: Checked Arithmetic
+// Keeps the wrapped result and raises the error flag when the exact result does not
+// fit in the tick count.
+struct __ArithmeticChecked
+{
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto add(const T a, const U b, const cxxtc::utility::fast_divisor&, bool& error) noexcept -> T
+    {
+        T result = 0;
+        error |= cxxtc::utility::internal::add_overflow(a, b, result);
+        return result;
+    }
+
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto sub(const T a, const U b, const cxxtc::utility::fast_divisor&, bool& error) noexcept -> T
+    {
+        T result = 0;
+        error |= cxxtc::utility::internal::sub_overflow(a, b, result);
+        return result;
+    }
+
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto mul(const T a, const U b, const cxxtc::utility::fast_divisor&, bool& error) noexcept -> T
+    {
+        T result = 0;
+        error |= cxxtc::utility::internal::mul_overflow(a, b, result);
+        return result;
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr auto narrow(const T value, const T max, bool& error) noexcept -> T
+    {
+        error |= value > max;
+        return value & max;
+    }
+};
+
+// @SECTION: Saturating Arithmetic
+// Clamps results to zero or to the largest tick count and raises the error flag,
+// as a negative set_ticks() does.
+struct __ArithmeticSaturating
+{
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto add(const T a, const U b, const cxxtc::utility::fast_divisor&, bool& error) noexcept -> T
+    {
+        T result = 0;
+        const bool overflow = cxxtc::utility::internal::add_overflow(a, b, result);
+        const T bound = std::cmp_less(b, 0) ? T{0} : std::numeric_limits<T>::max();
+        error |= overflow;
+        return overflow ? bound : result;
+    }
+
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto sub(const T a, const U b, const cxxtc::utility::fast_divisor&, bool& error) noexcept -> T
+    {
+        T result = 0;
+        const bool overflow = cxxtc::utility::internal::sub_overflow(a, b, result);
+        const T bound = std::cmp_less(b, 0) ? std::numeric_limits<T>::max() : T{0};
+        error |= overflow;
+        return overflow ? bound : result;
+    }
+
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto mul(const T a, const U b, const cxxtc::utility::fast_divisor&, bool& error) noexcept -> T
+    {
+        T result = 0;
+        const bool overflow = cxxtc::utility::internal::mul_overflow(a, b, result);
+        const T bound = std::cmp_less(b, 0) ? T{0} : std::numeric_limits<T>::max();
+        error |= overflow;
+        return overflow ? bound : result;
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr auto narrow(const T value, const T max, bool& error) noexcept -> T
+    {
+        error |= value > max;
+        return std::min(value, max);
+    }
+};
+
+// @SECTION: Time-of-day Arithmetic
+// Wraps results into a single 24-hour day, so stepping past midnight lands on
+// 00:00:00:00 and stepping back from it lands on the last frame of the day.
+struct __ArithmeticWrapDay
+{
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto add(const T a, const U b, const cxxtc::utility::fast_divisor& day, bool&) noexcept -> T
+    {
+        const T x = static_cast<T>(day.remainder(a));
+        const T y = static_cast<T>(day.remainder(magnitude<T>(b)));
+        const T d = static_cast<T>(day.divisor);
+
+        if (std::cmp_less(b, 0)) return (x - y) + (d * static_cast<T>(x < y));
+
+        const T result = x + y;
+        return result - (d * static_cast<T>(result >= d));
+    }
+
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto sub(const T a, const U b, const cxxtc::utility::fast_divisor& day, bool&) noexcept -> T
+    {
+        const T x = static_cast<T>(day.remainder(a));
+        const T y = static_cast<T>(day.remainder(magnitude<T>(b)));
+        const T d = static_cast<T>(day.divisor);
+
+        if (std::cmp_less(b, 0)) {
+            const T result = x + y;
+            return result - (d * static_cast<T>(result >= d));
+        }
+
+        return (x - y) + (d * static_cast<T>(x < y));
+    }
+
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto mul(const T a, const U b, const cxxtc::utility::fast_divisor& day, bool&) noexcept -> T
+    {
+        const T d = static_cast<T>(day.divisor);
+        const T result = static_cast<T>(cxxtc::utility::internal::mulmod(day.remainder(a), magnitude<T>(b), d));
+        return (std::cmp_less(b, 0) && result != 0) ? d - result : result;
+    }
+
+    // a day is always shorter than the tick count, so results already fit
+    template<std::unsigned_integral T>
+    static constexpr auto narrow(const T value, const T, bool&) noexcept -> T
+    {
+        return value;
+    }
+
+private:
+    template<std::unsigned_integral T, std::integral U>
+    static constexpr auto magnitude(const U value) noexcept -> T
+    {
+        return std::cmp_less(value, 0) ? (T{0} - static_cast<T>(value)) : static_cast<T>(value);
+    }
+};
+
+template<typename T>
+concept ArithmeticPolicy = requires (std::uint64_t a, int b, const cxxtc::utility::fast_divisor& day, bool& error) {
+                               { T::add(a, b, day, error) } -> std::same_as<std::uint64_t>;
+                               { T::sub(a, b, day, error) } -> std::same_as<std::uint64_t>;
+                               { T::mul(a, b, day, error) } -> std::same_as<std::uint64_t>;
+                               { T::narrow(a, a, error) } -> std::same_as<std::uint64_t>;
+                           };
+
+// @SECTION: Rounding
+// How a tick count is rounded when it is moved to another frame rate or to wall
+// time and the instant falls between two ticks or units of the target.
+enum class __Rounding : std::uint8_t
+{
+    nearest,
+    down,
+    up
+};
+
+// @SECTION: Parse Errors
+// Why a timecode string was rejected by parse().
+enum class __ParseError : std::uint8_t
+{
+    invalid_length,   // not HH:MM:SS:FF or HH:MM:SS:FF.SS
+    invalid_format,   // a group that isn't two digits or a misplaced separator
+    out_of_range,     // minutes, seconds or frames past the limits of the rate
+    skipped_label     // a label that drop-frame counting never shows
+};
+
 } // @END OF namespace cxxtc::chrono::internal
 
 ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,411 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Signed timecode durations for offset arithmetic
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// Library headers
+#include "timecode_basic.hpp"
+#include "timecode_common.hpp"
+#include "traits.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace cxxtc::chrono::internal {
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION __BasicTimecodeDuration Static Config --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#define TCDURATION_GROUP_WIDTH 2
+#define TCDURATION_SUBFRAMES_PER_FRAMES 100
+#define TCDURATION_SECS_PER_MIN 60
+#define TCDURATION_MINS_PER_HR 60
+#define TCDURATION_CHAR_OFFSET '0'
+#define TCDURATION_SIGN_NEGATIVE '-'
+#define TCDURATION_COLON ':'
+#define TCDURATION_COLON_SUBFRAMES '.'
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION __BasicTimecodeDuration
+//
+///////////////////////////////////////////////////////////////////////////
+
+// A signed span of ticks at a frame rate, for offsets such as source minus record
+// or slip amounts. Durations count elapsed frames, so drop-frame rates are never
+// relabelled and hours are not bounded by the 24-hour clock.
+template<std::integral TInt, FpsFormatFactory TFps>
+class __BasicTimecodeDuration
+{
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Type Aliases --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    using __my_type     = __BasicTimecodeDuration<TInt, TFps>;
+    using signed_type   = cxxtc::traits::to_signed_t<TInt>;
+    using unsigned_type = cxxtc::traits::to_unsigned_t<TInt>;
+    using fps_t         = TFps;
+    using fps_scalar_t  = typename TFps::type;
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Standard Library Support --
+//
+///////////////////////////////////////////////////////////////////////////
+
+friend std::ostream& operator<<(std::ostream& out, const __my_type& d)
+{
+    out << d.to_string();
+    return out;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Ctors, Dtors & Assignment --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    constexpr __BasicTimecodeDuration() = default;
+
+    template<std::integral T>
+    explicit constexpr __BasicTimecodeDuration(const T ticks,
+                                               const fps_scalar_t fps = fps_t::default_value()) noexcept
+        : _ticks(static_cast<signed_type>(ticks))
+        , _fps(fps)
+    {}
+
+    // the elapsed ticks of a timecode since 00:00:00:00
+    template<std::integral UInt,
+             std::floating_point TFloat,
+             cxxtc::traits::StringLike TString,
+             cxxtc::traits::StringLike TView,
+             ArithmeticPolicy TArith>
+    explicit constexpr __BasicTimecodeDuration(const __BasicTimecodeInt<UInt, TFloat, TString, TView, TFps, TArith>& tc) noexcept
+        : _ticks(static_cast<signed_type>(tc.ticks()))
+        , _fps(tc.fps())
+    {}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Accessors --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    constexpr auto ticks() const noexcept -> signed_type
+    {
+        return this->_ticks;
+    }
+
+    constexpr auto fps() const noexcept -> fps_scalar_t
+    {
+        return this->_fps;
+    }
+
+    constexpr bool is_negative() const noexcept
+    {
+        return this->_ticks < 0;
+    }
+
+    constexpr auto abs() const noexcept -> __my_type
+    {
+        return __my_type{ (this->_ticks < 0) ? -this->_ticks : this->_ticks, this->_fps };
+    }
+
+    // groups are the magnitude of the duration, the sign is reported by is_negative()
+    constexpr auto hours() const noexcept -> unsigned_type
+    {
+        return this->magnitude() / this->ticks_per_second() / TCDURATION_SECS_PER_MIN / TCDURATION_MINS_PER_HR;
+    }
+
+    constexpr auto minutes() const noexcept -> unsigned_type
+    {
+        return (this->magnitude() / this->ticks_per_second() / TCDURATION_SECS_PER_MIN) % TCDURATION_MINS_PER_HR;
+    }
+
+    constexpr auto seconds() const noexcept -> unsigned_type
+    {
+        return (this->magnitude() / this->ticks_per_second()) % TCDURATION_SECS_PER_MIN;
+    }
+
+    constexpr auto frames() const noexcept -> unsigned_type
+    {
+        return (this->magnitude() % this->ticks_per_second()) / TCDURATION_SUBFRAMES_PER_FRAMES;
+    }
+
+    constexpr auto subframes() const noexcept -> unsigned_type
+    {
+        return this->magnitude() % TCDURATION_SUBFRAMES_PER_FRAMES;
+    }
+
+    // formatted as [-]HH:MM:SS:FF, with .SS appended when there are subframes; hours
+    // take as many digits as they need
+    auto to_string() const -> std::string
+    {
+        std::string str;
+        if (this->is_negative()) str += TCDURATION_SIGN_NEGATIVE;
+
+        const auto append_group = [&str](unsigned_type value, const char separator) {
+            char digits[std::numeric_limits<unsigned_type>::digits10 + 1] = {};
+            std::size_t count = 0;
+
+            do {
+                digits[count++] = static_cast<char>(value % 10 + TCDURATION_CHAR_OFFSET);
+                value /= 10;
+            } while (value > 0);
+
+            while (count < TCDURATION_GROUP_WIDTH) digits[count++] = TCDURATION_CHAR_OFFSET;
+            if (separator != '\0') str += separator;
+            while (count > 0) str += digits[--count];
+        };
+
+        append_group(this->hours(), '\0');
+        append_group(this->minutes(), TCDURATION_COLON);
+        append_group(this->seconds(), TCDURATION_COLON);
+        append_group(this->frames(), TCDURATION_COLON);
+        if (this->subframes() != 0) append_group(this->subframes(), TCDURATION_COLON_SUBFRAMES);
+
+        return str;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Equality & Comparison
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    friend constexpr bool operator==(const __my_type& lhs, const __my_type& rhs) noexcept
+    {
+        return lhs.ticks() == rhs.ticks();
+    }
+
+    friend constexpr auto operator<=>(const __my_type& lhs, const __my_type& rhs) noexcept
+    {
+        return lhs.ticks() <=> rhs.ticks();
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Arithmetic Operations
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    constexpr auto operator-() const noexcept -> __my_type
+    {
+        return __my_type{ -this->_ticks, this->_fps };
+    }
+
+    friend constexpr __my_type& operator+=(__my_type& lhs, const __my_type& rhs) noexcept
+    {
+        assert(lhs.fps() == rhs.fps() && "durations in an arithmetic expression must have the same fps");
+        lhs._ticks += rhs._ticks;
+        return lhs;
+    }
+
+    friend constexpr __my_type& operator-=(__my_type& lhs, const __my_type& rhs) noexcept
+    {
+        assert(lhs.fps() == rhs.fps() && "durations in an arithmetic expression must have the same fps");
+        lhs._ticks -= rhs._ticks;
+        return lhs;
+    }
+
+    template<std::integral T>
+    friend constexpr __my_type& operator*=(__my_type& lhs, const T rhs) noexcept
+    {
+        lhs._ticks *= static_cast<signed_type>(rhs);
+        return lhs;
+    }
+
+    template<std::integral T>
+    friend constexpr __my_type& operator/=(__my_type& lhs, const T rhs) noexcept
+    {
+        assert(rhs != 0 && "division by zero in __BasicTimecodeDuration expression will result in undefined behaviour");
+        lhs._ticks /= static_cast<signed_type>(rhs);
+        return lhs;
+    }
+
+    friend constexpr __my_type operator+(__my_type lhs, const __my_type& rhs) noexcept
+    {
+        return lhs += rhs;
+    }
+
+    friend constexpr __my_type operator-(__my_type lhs, const __my_type& rhs) noexcept
+    {
+        return lhs -= rhs;
+    }
+
+    template<std::integral T>
+    friend constexpr __my_type operator*(__my_type lhs, const T rhs) noexcept
+    {
+        return lhs *= rhs;
+    }
+
+    template<std::integral T>
+    friend constexpr __my_type operator*(const T lhs, __my_type rhs) noexcept
+    {
+        return rhs *= lhs;
+    }
+
+    template<std::integral T>
+    friend constexpr __my_type operator/(__my_type lhs, const T rhs) noexcept
+    {
+        return lhs /= rhs;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Private Helper Methods --
+//
+///////////////////////////////////////////////////////////////////////////
+
+private:
+    constexpr auto magnitude() const noexcept -> unsigned_type
+    {
+        // negate in unsigned arithmetic so the most negative count does not overflow
+        return (this->_ticks < 0) ? (unsigned_type{0} - static_cast<unsigned_type>(this->_ticks))
+                                  : static_cast<unsigned_type>(this->_ticks);
+    }
+
+    constexpr auto ticks_per_second() const noexcept -> unsigned_type
+    {
+        const unsigned_type timebase = fps_t::to_timebase(this->_fps);
+        assert(timebase > 0 && "duration groups need an fps with a timebase");
+        return timebase * TCDURATION_SUBFRAMES_PER_FRAMES;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+// -- @SECTION Private Members --
+//
+///////////////////////////////////////////////////////////////////////////
+
+private:
+    signed_type _ticks = 0;
+    fps_scalar_t _fps = fps_t::default_value();
+};
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Mixed Timecode & Duration Arithmetic
+//
+///////////////////////////////////////////////////////////////////////////
+
+#define __TIMECODE_TYPE __BasicTimecodeInt<TInt, TFloat, TString, TView, TFps, TArith>
+#define __DURATION_TYPE __BasicTimecodeDuration<TInt, TFps>
+#define __TIMECODE_DURATION_TEMPLATE template<std::integral TInt,                   \
+                                              std::floating_point TFloat,           \
+                                              cxxtc::traits::StringLike TString,    \
+                                              cxxtc::traits::StringLike TView,      \
+                                              FpsFormatFactory TFps,                \
+                                              ArithmeticPolicy TArith>
+
+// offsetting a timecode keeps its fps; an offset out of range is handled by the
+// timecode's arithmetic policy
+__TIMECODE_DURATION_TEMPLATE
+constexpr auto operator+=(__TIMECODE_TYPE& lhs, const __DURATION_TYPE& rhs) -> __TIMECODE_TYPE&
+{
+    assert(lhs.fps() == rhs.fps() && "timecode and duration in an arithmetic expression must have the same fps");
+    return lhs += rhs.ticks();
+}
+
+__TIMECODE_DURATION_TEMPLATE
+constexpr auto operator-=(__TIMECODE_TYPE& lhs, const __DURATION_TYPE& rhs) -> __TIMECODE_TYPE&
+{
+    return lhs += -rhs;
+}
+
+__TIMECODE_DURATION_TEMPLATE
+constexpr auto operator+(__TIMECODE_TYPE lhs, const __DURATION_TYPE& rhs) -> __TIMECODE_TYPE
+{
+    return lhs += rhs;
+}
+
+__TIMECODE_DURATION_TEMPLATE
+constexpr auto operator+(const __DURATION_TYPE& lhs, __TIMECODE_TYPE rhs) -> __TIMECODE_TYPE
+{
+    return rhs += lhs;
+}
+
+__TIMECODE_DURATION_TEMPLATE
+constexpr auto operator-(__TIMECODE_TYPE lhs, const __DURATION_TYPE& rhs) -> __TIMECODE_TYPE
+{
+    return lhs -= rhs;
+}
+
+// signed distance from rhs to lhs, e.g. difference(source, record) for a slip amount
+__TIMECODE_DURATION_TEMPLATE
+constexpr auto difference(const __TIMECODE_TYPE& lhs, const __TIMECODE_TYPE& rhs) -> __DURATION_TYPE
+{
+    assert(lhs.fps() == rhs.fps() && "timecodes in a difference must have the same fps");
+    return __DURATION_TYPE{ lhs } - __DURATION_TYPE{ rhs };
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+#undef __TIMECODE_TYPE
+#undef __DURATION_TYPE
+#undef __TIMECODE_DURATION_TEMPLATE
+
+#undef TCDURATION_GROUP_WIDTH
+#undef TCDURATION_SUBFRAMES_PER_FRAMES
+#undef TCDURATION_SECS_PER_MIN
+#undef TCDURATION_MINS_PER_HR
+#undef TCDURATION_CHAR_OFFSET
+#undef TCDURATION_SIGN_NEGATIVE
+#undef TCDURATION_COLON
+#undef TCDURATION_COLON_SUBFRAMES
+
+} // @END OF namespace cxxtc::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
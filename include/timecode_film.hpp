@@ -0,0 +1,349 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Film footage (feet+frames) and KeyKode edge numbers
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+#include <utility>
+
+// Library headers
+#include "utility.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace cxxtc::chrono::internal {
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Film Static Config --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#define TCFILM_PERFS_PER_FOOT_35MM 64
+#define TCFILM_PERFS_PER_FOOT_16MM 40
+#define TCFILM_PERFS_PER_KEY_16MM 20
+#define TCFILM_KEYKODE_COUNT_DIGITS 4
+#define TCFILM_KEYKODE_COUNT_WRAP 10000
+#define TCFILM_KEYKODE_SIZE 18
+#define TCFILM_FRAMES_DIGITS 2
+#define TCFILM_SEPARATOR_FRAMES '+'
+#define TCFILM_SEPARATOR_KEYKODE ' '
+#define TCFILM_CHAR_OFFSET '0'
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Film Gauges
+//
+///////////////////////////////////////////////////////////////////////////
+
+enum class __FilmGauge : std::uint8_t
+{
+    mm35_4perf, // 16 frames per foot
+    mm35_3perf, // 21 1/3 frames per foot, feet hold 22, 21 and 21 frames in turn
+    mm35_2perf, // 32 frames per foot
+    mm16,       // 40 frames per foot, a key number every half foot
+    total
+};
+
+// Every gauge is counted in perforations so feet and key numbers that start in
+// the middle of a frame (3-perf) stay exact. A foot or key starts at the first
+// whole frame at or after its perforation.
+struct __FilmLayout
+{
+    cxxtc::utility::fast_divisor perfs_per_foot;
+    cxxtc::utility::fast_divisor perfs_per_frame;
+    cxxtc::utility::fast_divisor perfs_per_key;
+};
+
+static constexpr auto __init_film_layout(const __FilmGauge gauge) -> __FilmLayout
+{
+    const auto layout = [](const std::uint64_t foot, const std::uint64_t frame, const std::uint64_t key) constexpr {
+        return __FilmLayout{ cxxtc::utility::fast_divisor(foot),
+                             cxxtc::utility::fast_divisor(frame),
+                             cxxtc::utility::fast_divisor(key) };
+    };
+
+    switch (gauge) {
+        case __FilmGauge::mm35_4perf: return layout(TCFILM_PERFS_PER_FOOT_35MM, 4, TCFILM_PERFS_PER_FOOT_35MM);
+        case __FilmGauge::mm35_3perf: return layout(TCFILM_PERFS_PER_FOOT_35MM, 3, TCFILM_PERFS_PER_FOOT_35MM);
+        case __FilmGauge::mm35_2perf: return layout(TCFILM_PERFS_PER_FOOT_35MM, 2, TCFILM_PERFS_PER_FOOT_35MM);
+        case __FilmGauge::mm16:       return layout(TCFILM_PERFS_PER_FOOT_16MM, 1, TCFILM_PERFS_PER_KEY_16MM);
+        case __FilmGauge::total:      break;
+    }
+
+    return layout(1, 1, 1);
+}
+
+template<std::size_t... Is>
+static constexpr auto __init_film_layout_table(std::index_sequence<Is...> seq)
+{
+    return std::array<__FilmLayout, sizeof...(Is)>{ __init_film_layout(static_cast<__FilmGauge>(Is)) ... };
+}
+
+// divisors are built during compilation, converting a count is multiplies and shifts
+static constexpr auto __film_layouts = __init_film_layout_table(std::make_index_sequence<static_cast<std::size_t>(__FilmGauge::total)>{});
+
+static constexpr auto __film_layout(const __FilmGauge gauge) -> const __FilmLayout&
+{
+    assert(gauge < __FilmGauge::total && "film gauge passed to a footage conversion is not a gauge");
+    return __film_layouts[static_cast<std::size_t>(gauge)];
+}
+
+// the first whole frame at or after a perforation
+static constexpr auto __first_frame_at(const std::uint64_t perfs, const __FilmLayout& layout) -> std::uint64_t
+{
+    return layout.perfs_per_frame.divide(perfs + layout.perfs_per_frame.divisor - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Feet+Frames
+//
+///////////////////////////////////////////////////////////////////////////
+
+// a footage count: whole feet and the frames since the first frame of that foot
+struct __FeetFrames
+{
+    std::uint64_t feet = 0;
+    std::uint32_t frames = 0;
+    __FilmGauge gauge = __FilmGauge::mm35_4perf;
+
+    friend constexpr bool operator==(const __FeetFrames&, const __FeetFrames&) = default;
+};
+
+static constexpr auto __to_feet_frames(const std::uint64_t frames, const __FilmGauge gauge, const __FilmLayout& layout) -> __FeetFrames
+{
+    const std::uint64_t feet = layout.perfs_per_foot.divide(frames * layout.perfs_per_frame.divisor);
+    const std::uint64_t first = __first_frame_at(feet * layout.perfs_per_foot.divisor, layout);
+
+    return __FeetFrames{ feet, static_cast<std::uint32_t>(frames - first), gauge };
+}
+
+static constexpr auto __to_feet_frames(const std::uint64_t frames, const __FilmGauge gauge) -> __FeetFrames
+{
+    return __to_feet_frames(frames, gauge, __film_layout(gauge));
+}
+
+static constexpr auto __from_feet_frames(const __FeetFrames& footage) -> std::uint64_t
+{
+    const __FilmLayout& layout = __film_layout(footage.gauge);
+    return __first_frame_at(footage.feet * layout.perfs_per_foot.divisor, layout) + footage.frames;
+}
+
+// the layout is looked up once for the whole batch
+template<typename TFrames>
+static constexpr void __to_feet_frames_batch(const std::size_t count,
+                                             TFrames&& frames_fn,
+                                             const __FilmGauge gauge,
+                                             std::span<__FeetFrames> out)
+{
+    assert(out.size() >= count && "output span of cxxtc::chrono::internal::__to_feet_frames_batch is too small");
+
+    const __FilmLayout& layout = __film_layout(gauge);
+    for (std::size_t i = 0; i < count; ++i) out[i] = __to_feet_frames(frames_fn(i), gauge, layout);
+}
+
+// FEET+FF, feet without padding and frames as two digits, e.g. 1234+05
+static inline auto __feet_frames_to_chars(char* first, char* last, const __FeetFrames& footage) -> std::to_chars_result
+{
+    const std::to_chars_result feet = std::to_chars(first, last, footage.feet);
+    if (feet.ec != std::errc{} || last - feet.ptr < 1 + TCFILM_FRAMES_DIGITS) return { last, std::errc::value_too_large };
+
+    char* out = feet.ptr;
+    out[0] = TCFILM_SEPARATOR_FRAMES;
+    out[1] = static_cast<char>(TCFILM_CHAR_OFFSET + ((footage.frames / 10) % 10));
+    out[2] = static_cast<char>(TCFILM_CHAR_OFFSET + (footage.frames % 10));
+
+    return { out + 1 + TCFILM_FRAMES_DIGITS, std::errc{} };
+}
+
+// reads FEET+F or FEET+FF, the frames must fall inside the foot for the gauge
+static inline auto __feet_frames_from_chars(const char* first, const char* last, __FeetFrames& footage) -> std::from_chars_result
+{
+    std::uint64_t feet = 0;
+    const std::from_chars_result feet_result = std::from_chars(first, last, feet);
+    if (feet_result.ec != std::errc{}) return feet_result;
+
+    const char* in = feet_result.ptr;
+    if (in == last || *in != TCFILM_SEPARATOR_FRAMES) return { first, std::errc::invalid_argument };
+
+    std::uint32_t frames = 0;
+    const std::from_chars_result frames_result = std::from_chars(in + 1, std::min(last, in + 1 + TCFILM_FRAMES_DIGITS), frames);
+    if (frames_result.ec != std::errc{}) return { first, std::errc::invalid_argument };
+
+    const __FilmLayout& layout = __film_layout(footage.gauge);
+    const std::uint64_t frames_in_foot = __first_frame_at((feet + 1) * layout.perfs_per_foot.divisor, layout)
+                                       - __first_frame_at(feet * layout.perfs_per_foot.divisor, layout);
+
+    if (frames >= frames_in_foot) return { frames_result.ptr, std::errc::result_out_of_range };
+
+    footage.feet = feet;
+    footage.frames = frames;
+    return { frames_result.ptr, std::errc{} };
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION KeyKode
+//
+///////////////////////////////////////////////////////////////////////////
+
+// A KeyKode edge number: the manufacturer and film type code, the 6-digit prefix
+// of the roll, the key count and the whole frames since the first frame of that
+// key. Counts keep growing past 9999 here and wrap when written.
+struct __KeyKode
+{
+    std::array<char, 2> manufacturer{ 'K', 'U' };
+    std::uint32_t prefix = 0;
+    std::uint64_t count = 0;
+    std::uint32_t frames = 0;
+    __FilmGauge gauge = __FilmGauge::mm35_4perf;
+
+    friend constexpr bool operator==(const __KeyKode&, const __KeyKode&) = default;
+};
+
+// frames from the zero key of the roll
+static constexpr auto __keykode_to_roll_frames(const __KeyKode& key) -> std::uint64_t
+{
+    const __FilmLayout& layout = __film_layout(key.gauge);
+    return __first_frame_at(key.count * layout.perfs_per_key.divisor, layout) + key.frames;
+}
+
+// the edge number of a frame on the roll of key
+static constexpr auto __keykode_at_roll_frames(const std::uint64_t frames, const __KeyKode& key, const __FilmLayout& layout) -> __KeyKode
+{
+    const std::uint64_t count = layout.perfs_per_key.divide(frames * layout.perfs_per_frame.divisor);
+    const std::uint64_t first = __first_frame_at(count * layout.perfs_per_key.divisor, layout);
+
+    return __KeyKode{ key.manufacturer, key.prefix, count, static_cast<std::uint32_t>(frames - first), key.gauge };
+}
+
+static constexpr auto __keykode_at_roll_frames(const std::uint64_t frames, const __KeyKode& key) -> __KeyKode
+{
+    return __keykode_at_roll_frames(frames, key, __film_layout(key.gauge));
+}
+
+// Edge numbers for frames offset from a sync point, e.g. the frames of a timecode
+// column against the timecode and KeyKode of a sync frame. Frames before the
+// start of the roll are clamped to it.
+template<typename TOffsets>
+static constexpr void __keykode_batch(const std::size_t count,
+                                      TOffsets&& offset_fn,
+                                      const __KeyKode& sync_key,
+                                      std::span<__KeyKode> out)
+{
+    assert(out.size() >= count && "output span of cxxtc::chrono::internal::__keykode_batch is too small");
+
+    const __FilmLayout& layout = __film_layout(sync_key.gauge);
+    const auto sync = static_cast<std::int64_t>(__keykode_to_roll_frames(sync_key));
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::int64_t frames = sync + static_cast<std::int64_t>(offset_fn(i));
+        out[i] = __keykode_at_roll_frames(static_cast<std::uint64_t>(std::max<std::int64_t>(frames, 0)), sync_key, layout);
+    }
+}
+
+// MM PP PPPP CCCC+FF, e.g. KU 22 9012 3456+12
+static inline auto __keykode_to_chars(char* first, char* last, const __KeyKode& key) -> std::to_chars_result
+{
+    if (last - first < TCFILM_KEYKODE_SIZE) return { last, std::errc::value_too_large };
+
+    const auto write_digits = [](char* out, std::uint64_t value, const std::size_t digits) {
+        for (std::size_t i = digits; i > 0; --i) {
+            out[i - 1] = static_cast<char>(TCFILM_CHAR_OFFSET + (value % 10));
+            value /= 10;
+        }
+    };
+
+    first[0] = key.manufacturer[0];
+    first[1] = key.manufacturer[1];
+    first[2] = TCFILM_SEPARATOR_KEYKODE;
+    write_digits(first + 3, key.prefix / 10000, 2);
+    first[5] = TCFILM_SEPARATOR_KEYKODE;
+    write_digits(first + 6, key.prefix % 10000, 4);
+    first[10] = TCFILM_SEPARATOR_KEYKODE;
+    write_digits(first + 11, key.count % TCFILM_KEYKODE_COUNT_WRAP, TCFILM_KEYKODE_COUNT_DIGITS);
+    first[15] = TCFILM_SEPARATOR_FRAMES;
+    write_digits(first + 16, key.frames, TCFILM_FRAMES_DIGITS);
+
+    return { first + TCFILM_KEYKODE_SIZE, std::errc{} };
+}
+
+// the count is read as written, without the wraps of the roll
+static inline auto __keykode_from_chars(const char* first, const char* last, __KeyKode& key) -> std::from_chars_result
+{
+    if (last - first < TCFILM_KEYKODE_SIZE) return { first, std::errc::invalid_argument };
+
+    const auto read_digits = [&](const std::size_t offset, const std::size_t digits, std::uint64_t& value) {
+        value = 0;
+        for (std::size_t i = offset; i < offset + digits; ++i) {
+            const auto digit = static_cast<unsigned char>(first[i] - TCFILM_CHAR_OFFSET);
+            if (digit > 9) return false;
+            value = (value * 10) + digit;
+        }
+
+        return true;
+    };
+
+    std::uint64_t prefix_high = 0;
+    std::uint64_t prefix_low = 0;
+    std::uint64_t count = 0;
+    std::uint64_t frames = 0;
+    const bool valid = first[2] == TCFILM_SEPARATOR_KEYKODE && first[5] == TCFILM_SEPARATOR_KEYKODE
+                    && first[10] == TCFILM_SEPARATOR_KEYKODE && first[15] == TCFILM_SEPARATOR_FRAMES
+                    && read_digits(3, 2, prefix_high) && read_digits(6, 4, prefix_low)
+                    && read_digits(11, TCFILM_KEYKODE_COUNT_DIGITS, count)
+                    && read_digits(16, TCFILM_FRAMES_DIGITS, frames);
+
+    if (!valid) return { first, std::errc::invalid_argument };
+
+    const __FilmLayout& layout = __film_layout(key.gauge);
+    const std::uint64_t frames_in_key = __first_frame_at((count + 1) * layout.perfs_per_key.divisor, layout)
+                                      - __first_frame_at(count * layout.perfs_per_key.divisor, layout);
+
+    if (frames >= frames_in_key) return { first + TCFILM_KEYKODE_SIZE, std::errc::result_out_of_range };
+
+    key.manufacturer = { first[0], first[1] };
+    key.prefix = static_cast<std::uint32_t>((prefix_high * 10000) + prefix_low);
+    key.count = count;
+    key.frames = static_cast<std::uint32_t>(frames);
+    return { first + TCFILM_KEYKODE_SIZE, std::errc{} };
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+#undef TCFILM_PERFS_PER_FOOT_35MM
+#undef TCFILM_PERFS_PER_FOOT_16MM
+#undef TCFILM_PERFS_PER_KEY_16MM
+#undef TCFILM_KEYKODE_COUNT_DIGITS
+#undef TCFILM_KEYKODE_COUNT_WRAP
+#undef TCFILM_KEYKODE_SIZE
+#undef TCFILM_FRAMES_DIGITS
+#undef TCFILM_SEPARATOR_FRAMES
+#undef TCFILM_SEPARATOR_KEYKODE
+#undef TCFILM_CHAR_OFFSET
+
+} // @END OF namespace cxxtc::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
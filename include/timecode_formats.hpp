@@ -0,0 +1,216 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Reading timecodes in the mix of text formats found in real sources
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Library headers
+#include "timecode_basic.hpp"
+#include "timecode_common.hpp"
+#include "utility.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace cxxtc::chrono::internal {
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Text Format Static Config --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#define TCFORMAT_SIZE_LABEL 11
+#define TCFORMAT_SIZE_LABEL_WITH_SUBFRAMES 14
+#define TCFORMAT_SIZE_MILLISECONDS 12
+#define TCFORMAT_FRAMES_MAX_DIGITS 15
+#define TCFORMAT_FIRST_COLON_INDEX 2
+#define TCFORMAT_SECOND_COLON_INDEX 5
+#define TCFORMAT_FRAMES_COLON_INDEX 8
+#define TCFORMAT_SUBFRAMES_COLON_INDEX 11
+#define TCFORMAT_CHAR_OFFSET '0'
+#define TCFORMAT_COLON_DEFAULT ':'
+#define TCFORMAT_COLON_DROPFRAME ';'
+#define TCFORMAT_COLON_DECIMAL '.'
+#define TCFORMAT_COLON_DECIMAL_COMMA ','
+#define TCFORMAT_SUBFRAMES_PER_FRAMES 100
+#define TCFORMAT_SECS_PER_MIN 60
+#define TCFORMAT_MINS_PER_HR 60
+#define TCFORMAT_MS_PER_SEC 1000
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Text Format Classification
+//
+///////////////////////////////////////////////////////////////////////////
+
+enum class __TextFormat : std::uint8_t
+{
+    unknown,
+    label,                // HH:MM:SS:FF, HH:MM:SS;FF or HH:MM:SS.FF
+    label_with_subframes, // HH:MM:SS:FF.SS
+    frames,               // a raw frame count
+    milliseconds          // HH:MM:SS.mmm or HH:MM:SS,mmm as in subtitle files
+};
+
+static constexpr auto __is_digit_char(const char c) noexcept -> bool
+{
+    return static_cast<unsigned char>(c - TCFORMAT_CHAR_OFFSET) <= 9;
+}
+
+// The shape of a timecode string from its length and one or two separator bytes.
+// Only classifies, the reader of each shape validates the rest.
+static constexpr auto __classify_text(const std::string_view tc) noexcept -> __TextFormat
+{
+    if (tc.length() > TCFORMAT_FIRST_COLON_INDEX && tc[TCFORMAT_FIRST_COLON_INDEX] == TCFORMAT_COLON_DEFAULT) {
+        const char separator = (tc.length() > TCFORMAT_FRAMES_COLON_INDEX) ? tc[TCFORMAT_FRAMES_COLON_INDEX] : 0;
+
+        switch (tc.length()) {
+            case TCFORMAT_SIZE_LABEL:
+                return (separator == TCFORMAT_COLON_DEFAULT || separator == TCFORMAT_COLON_DROPFRAME || separator == TCFORMAT_COLON_DECIMAL)
+                     ? __TextFormat::label
+                     : __TextFormat::unknown;
+
+            case TCFORMAT_SIZE_LABEL_WITH_SUBFRAMES:
+                return (tc[TCFORMAT_SUBFRAMES_COLON_INDEX] == TCFORMAT_COLON_DECIMAL)
+                     ? __TextFormat::label_with_subframes
+                     : __TextFormat::unknown;
+
+            case TCFORMAT_SIZE_MILLISECONDS:
+                return (separator == TCFORMAT_COLON_DECIMAL || separator == TCFORMAT_COLON_DECIMAL_COMMA)
+                     ? __TextFormat::milliseconds
+                     : __TextFormat::unknown;
+
+            default:
+                return __TextFormat::unknown;
+        }
+    }
+
+    if (tc.empty() || tc.length() > TCFORMAT_FRAMES_MAX_DIGITS) return __TextFormat::unknown;
+
+    for (const char c : tc) {
+        if (!__is_digit_char(c)) return __TextFormat::unknown;
+    }
+
+    return __TextFormat::frames;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION Text Format Readers
+//
+///////////////////////////////////////////////////////////////////////////
+
+template<typename TTimecode>
+using __read_result = cxxtc::utility::expected<TTimecode, __ParseError>;
+
+// labels go through the checked parser, '.' before the frames is read as ':'
+template<typename TTimecode>
+static constexpr auto __read_label(const std::string_view tc, const typename TTimecode::fps_scalar_t fps) -> __read_result<TTimecode>
+{
+    if (tc[TCFORMAT_FRAMES_COLON_INDEX] != TCFORMAT_COLON_DECIMAL) return TTimecode::parse(tc, fps);
+
+    char label[TCFORMAT_SIZE_LABEL]{};
+    for (std::size_t i = 0; i < TCFORMAT_SIZE_LABEL; ++i) label[i] = tc[i];
+    label[TCFORMAT_FRAMES_COLON_INDEX] = TCFORMAT_COLON_DEFAULT;
+
+    return TTimecode::parse(std::string_view{ label, TCFORMAT_SIZE_LABEL }, fps);
+}
+
+// classified as at most 15 digits, so the count can't overflow
+template<typename TTimecode>
+static constexpr auto __read_frames(const std::string_view tc, const typename TTimecode::fps_scalar_t fps) -> __read_result<TTimecode>
+{
+    std::uint64_t frames = 0;
+    for (const char c : tc) frames = (frames * 10) + static_cast<std::uint64_t>(c - TCFORMAT_CHAR_OFFSET);
+
+    if (frames > TTimecode::max_ticks() / TCFORMAT_SUBFRAMES_PER_FRAMES) {
+        return cxxtc::utility::unexpected<__ParseError>{ __ParseError::out_of_range };
+    }
+
+    return TTimecode{ frames * TCFORMAT_SUBFRAMES_PER_FRAMES, fps };
+}
+
+// wall-clock time converted at the exact rate, to the last subframe at or before it
+template<typename TTimecode>
+static constexpr auto __read_milliseconds(const std::string_view tc, const typename TTimecode::fps_scalar_t fps) -> __read_result<TTimecode>
+{
+    using failure = cxxtc::utility::unexpected<__ParseError>;
+
+    const auto pair = [&](const std::size_t i) -> std::uint64_t {
+        return static_cast<std::uint64_t>(((tc[i] - TCFORMAT_CHAR_OFFSET) * 10) + (tc[i + 1] - TCFORMAT_CHAR_OFFSET));
+    };
+
+    const bool well_formed = __is_digit_char(tc[0]) && __is_digit_char(tc[1])
+                          && tc[TCFORMAT_SECOND_COLON_INDEX] == TCFORMAT_COLON_DEFAULT
+                          && __is_digit_char(tc[3]) && __is_digit_char(tc[4])
+                          && __is_digit_char(tc[6]) && __is_digit_char(tc[7])
+                          && __is_digit_char(tc[9]) && __is_digit_char(tc[10]) && __is_digit_char(tc[11]);
+
+    if (!well_formed) return failure{ __ParseError::invalid_format };
+
+    const std::uint64_t hours = pair(0);
+    const std::uint64_t minutes = pair(3);
+    const std::uint64_t seconds = pair(6);
+    const std::uint64_t milliseconds = (pair(9) * 10) + static_cast<std::uint64_t>(tc[11] - TCFORMAT_CHAR_OFFSET);
+
+    if (minutes >= TCFORMAT_MINS_PER_HR || seconds >= TCFORMAT_SECS_PER_MIN) return failure{ __ParseError::out_of_range };
+
+    const std::uint64_t total_seconds = (((hours * TCFORMAT_MINS_PER_HR) + minutes) * TCFORMAT_SECS_PER_MIN) + seconds;
+
+    TTimecode result{ 0, fps };
+    result.set_time((total_seconds * TCFORMAT_MS_PER_SEC) + milliseconds, TCFORMAT_MS_PER_SEC);
+    return result;
+}
+
+// classifies the string once and hands it to the reader of its shape
+template<typename TTimecode>
+static constexpr auto __read_timecode(const std::string_view tc, const typename TTimecode::fps_scalar_t fps) -> __read_result<TTimecode>
+{
+    switch (__classify_text(tc)) {
+        case __TextFormat::label:
+        case __TextFormat::label_with_subframes: return __read_label<TTimecode>(tc, fps);
+        case __TextFormat::frames:               return __read_frames<TTimecode>(tc, fps);
+        case __TextFormat::milliseconds:         return __read_milliseconds<TTimecode>(tc, fps);
+        case __TextFormat::unknown:              break;
+    }
+
+    return cxxtc::utility::unexpected<__ParseError>{ __ParseError::invalid_format };
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+#undef TCFORMAT_SIZE_LABEL
+#undef TCFORMAT_SIZE_LABEL_WITH_SUBFRAMES
+#undef TCFORMAT_SIZE_MILLISECONDS
+#undef TCFORMAT_FRAMES_MAX_DIGITS
+#undef TCFORMAT_FIRST_COLON_INDEX
+#undef TCFORMAT_SECOND_COLON_INDEX
+#undef TCFORMAT_FRAMES_COLON_INDEX
+#undef TCFORMAT_SUBFRAMES_COLON_INDEX
+#undef TCFORMAT_CHAR_OFFSET
+#undef TCFORMAT_COLON_DEFAULT
+#undef TCFORMAT_COLON_DROPFRAME
+#undef TCFORMAT_COLON_DECIMAL
+#undef TCFORMAT_COLON_DECIMAL_COMMA
+#undef TCFORMAT_SUBFRAMES_PER_FRAMES
+#undef TCFORMAT_SECS_PER_MIN
+#undef TCFORMAT_MINS_PER_HR
+#undef TCFORMAT_MS_PER_SEC
+
+} // @END OF namespace cxxtc::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,348 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Linear timecode (LTC) codewords of SMPTE ST 12-1
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Library headers
+#include "timecode_basic.hpp"
+#include "timecode_common.hpp"
+#include "utility.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace cxxtc::chrono::internal {
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION LTC Static Config --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#define TCLTC_SYNC_WORD 0xBFFC
+#define TCLTC_SYNC_ONES 13
+#define TCLTC_CODEWORD_BYTES 10
+#define TCLTC_TIMEBASE_MAX 30
+#define TCLTC_HOURS_PER_DAY 24
+#define TCLTC_DROP_FRAME_BIT 10
+#define TCLTC_COLOR_FRAME_BIT 11
+#define TCLTC_USER_BITS_SHIFT 4
+#define TCLTC_LANE_UNITS 0x000F000F000F000FULL
+#define TCLTC_LANE_TENS 0x0003000700070003ULL
+#define TCLTC_LANE_DIGIT_CARRY 0x0006000600060006ULL
+#define TCLTC_LANE_DIGIT_OVERFLOW 0x0010001000100010ULL
+#define TCLTC_LANE_BITS 16
+#define TCLTC_GROUP_HRS 0
+#define TCLTC_GROUP_MINS 1
+#define TCLTC_GROUP_SECS 2
+#define TCLTC_GROUP_FRAMES 3
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION LTC Codeword
+//
+///////////////////////////////////////////////////////////////////////////
+
+// The 80 bits of an LTC frame with bit 0 the first bit on the wire: 64 bits of
+// time address, user bits and flags, then the 16 bit sync word 0011 1111 1111 1101,
+// which read least significant bit first is 0xBFFC.
+struct __LtcCodeword
+{
+    std::uint64_t data = 0;
+    std::uint16_t sync = TCLTC_SYNC_WORD;
+
+    // the codeword as transmitted, bit 0 of byte 0 first
+    constexpr auto to_bytes() const noexcept -> std::array<std::uint8_t, TCLTC_CODEWORD_BYTES>
+    {
+        std::array<std::uint8_t, TCLTC_CODEWORD_BYTES> bytes{};
+        for (std::size_t i = 0; i < sizeof(this->data); ++i) bytes[i] = static_cast<std::uint8_t>(this->data >> (8 * i));
+        bytes[8] = static_cast<std::uint8_t>(this->sync);
+        bytes[9] = static_cast<std::uint8_t>(this->sync >> 8);
+        return bytes;
+    }
+
+    static constexpr auto from_bytes(const std::array<std::uint8_t, TCLTC_CODEWORD_BYTES>& bytes) noexcept -> __LtcCodeword
+    {
+        __LtcCodeword codeword{ 0, 0 };
+        for (std::size_t i = 0; i < sizeof(codeword.data); ++i) codeword.data |= std::uint64_t{ bytes[i] } << (8 * i);
+        codeword.sync = static_cast<std::uint16_t>(bytes[8] | (bytes[9] << 8));
+        return codeword;
+    }
+
+    friend constexpr bool operator==(const __LtcCodeword&, const __LtcCodeword&) = default;
+};
+
+// The codeword bits besides the time address. The drop-frame flag follows the
+// rate of the timecode, and the polarity correction bit is computed on encode
+// so the codeword holds an even number of zeros; decoding reports both.
+struct __LtcFields
+{
+    std::uint32_t user_bits = 0;
+    std::uint8_t binary_group_flags = 0;
+    bool color_frame = false;
+    bool drop_frame = false;
+    bool polarity_correction = false;
+
+    friend constexpr bool operator==(const __LtcFields&, const __LtcFields&) = default;
+};
+
+template<typename TTimecode>
+struct __LtcFrame
+{
+    TTimecode tc{};
+    __LtcFields fields{};
+};
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION LTC Tables
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Bits of the polarity correction and binary group flags. The 24 and 30 frame
+// families share one assignment, the 25 frame family moves the three flags.
+struct __LtcFlagLayout
+{
+    std::uint8_t polarity_correction;
+    std::array<std::uint8_t, 3> binary_group_flags;
+};
+
+static constexpr std::array<__LtcFlagLayout, 2> __ltc_flag_layouts {
+    __LtcFlagLayout{ 27, { 43, 58, 59 } },
+    __LtcFlagLayout{ 59, { 27, 58, 43 } }
+};
+
+static constexpr auto __ltc_flag_layout(const std::uint64_t timebase) -> const __LtcFlagLayout&
+{
+    return __ltc_flag_layouts[static_cast<std::size_t>(timebase == 25)];
+}
+
+// packed BCD of 0 to 99, tens in the high nibble
+static constexpr std::array<std::uint8_t, 100> __ltc_bcd_table = []() {
+    std::array<std::uint8_t, 100> table{};
+    for (std::size_t i = 0; i < table.size(); ++i) table[i] = static_cast<std::uint8_t>(((i / 10) << 4) | (i % 10));
+    return table;
+}();
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION LTC Bit Packing
+//
+///////////////////////////////////////////////////////////////////////////
+
+// The four time groups sit in 16 bit lanes, frames lowest: units in bits 0 to 3
+// of a lane and tens from bit 8. The eight user bit groups fill the nibbles at
+// bit 8k + 4 between them. Both are spread and gathered with shifts and masks.
+static constexpr auto __ltc_spread_bytes(const std::uint32_t bytes) -> std::uint64_t
+{
+    std::uint64_t x = bytes;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    return x;
+}
+
+static constexpr auto __ltc_spread_user_bits(const std::uint32_t user_bits) -> std::uint64_t
+{
+    std::uint64_t x = __ltc_spread_bytes(user_bits);
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return x << TCLTC_USER_BITS_SHIFT;
+}
+
+static constexpr auto __ltc_gather_user_bits(const std::uint64_t data) -> std::uint32_t
+{
+    std::uint64_t x = (data >> TCLTC_USER_BITS_SHIFT) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x >> 4)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x >> 8)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x >> 16));
+    return static_cast<std::uint32_t>(x);
+}
+
+static constexpr auto __ltc_bit(const bool value, const std::size_t index) -> std::uint64_t
+{
+    return std::uint64_t{ value } << index;
+}
+
+static constexpr auto __ltc_test_bit(const std::uint64_t data, const std::size_t index) -> bool
+{
+    return ((data >> index) & 1) != 0;
+}
+
+// Hours wrap to the 24 hour clock of LTC. Rates above 30 fps have no plain LTC
+// time address and are rejected.
+template<typename TTimecode>
+static constexpr auto __encode_ltc(const TTimecode& tc, const __LtcFields& fields) -> __LtcCodeword
+{
+    using fps_t = typename TTimecode::fps_t;
+    const auto timebase = static_cast<std::uint64_t>(fps_t::to_timebase(tc.fps()));
+    assert(timebase <= TCLTC_TIMEBASE_MAX && "rate of an LTC codeword must be 30 fps or less");
+
+    const auto groups = tc.label_groups();
+    const std::uint32_t bcd = std::uint32_t{ __ltc_bcd_table[groups[TCLTC_GROUP_FRAMES]] }
+                            | (std::uint32_t{ __ltc_bcd_table[groups[TCLTC_GROUP_SECS]] } << 8)
+                            | (std::uint32_t{ __ltc_bcd_table[groups[TCLTC_GROUP_MINS]] } << 16)
+                            | (std::uint32_t{ __ltc_bcd_table[groups[TCLTC_GROUP_HRS] % TCLTC_HOURS_PER_DAY] } << 24);
+
+    const std::uint64_t lanes = __ltc_spread_bytes(bcd);
+    const __LtcFlagLayout& layout = __ltc_flag_layout(timebase);
+
+    std::uint64_t data = (lanes & TCLTC_LANE_UNITS) | ((lanes & (TCLTC_LANE_UNITS << 4)) << 4);
+    data |= __ltc_spread_user_bits(fields.user_bits);
+    data |= __ltc_bit(tc.is_drop_frame(), TCLTC_DROP_FRAME_BIT);
+    data |= __ltc_bit(fields.color_frame, TCLTC_COLOR_FRAME_BIT);
+    data |= __ltc_bit((fields.binary_group_flags & 0b001) != 0, layout.binary_group_flags[0]);
+    data |= __ltc_bit((fields.binary_group_flags & 0b010) != 0, layout.binary_group_flags[1]);
+    data |= __ltc_bit((fields.binary_group_flags & 0b100) != 0, layout.binary_group_flags[2]);
+
+    // the sync word holds 13 ones, so an odd count in the data makes the total even
+    const bool polarity = ((std::popcount(data) + TCLTC_SYNC_ONES) & 1) != 0;
+    data |= __ltc_bit(polarity, layout.polarity_correction);
+
+    return __LtcCodeword{ data, TCLTC_SYNC_WORD };
+}
+
+// A codeword without the sync word, with a digit past 9 or with a drop-frame flag
+// that does not match the rate fails with invalid_format, labels outside the
+// rate fail as in parse().
+template<typename TTimecode>
+static constexpr auto __decode_ltc(const __LtcCodeword& codeword, const typename TTimecode::fps_scalar_t fps)
+    -> cxxtc::utility::expected<__LtcFrame<TTimecode>, __ParseError>
+{
+    using failure = cxxtc::utility::unexpected<__ParseError>;
+    using fps_t = typename TTimecode::fps_t;
+    using groups_t = typename TTimecode::groups_t;
+    using unsigned_type = typename groups_t::value_type;
+
+    const auto timebase = static_cast<std::uint64_t>(fps_t::to_timebase(fps));
+    assert(timebase <= TCLTC_TIMEBASE_MAX && "rate of an LTC codeword must be 30 fps or less");
+
+    const std::uint64_t data = codeword.data;
+    const std::uint64_t units = data & TCLTC_LANE_UNITS;
+    const std::uint64_t tens = (data >> 8) & TCLTC_LANE_TENS;
+    const bool drop_frame = __ltc_test_bit(data, TCLTC_DROP_FRAME_BIT);
+
+    // a unit past 9 carries into bit 4 of its lane once 6 is added
+    const bool digits = ((units + TCLTC_LANE_DIGIT_CARRY) & TCLTC_LANE_DIGIT_OVERFLOW) == 0;
+    const bool format = (codeword.sync == TCLTC_SYNC_WORD) & digits & (drop_frame == fps_t::is_drop_frame(fps));
+    if (!format) return failure{ __ParseError::invalid_format };
+
+    const std::uint64_t lanes = units + (tens << 3) + (tens << 1);
+    const auto lane = [lanes](const std::size_t i) { return static_cast<unsigned_type>((lanes >> (i * TCLTC_LANE_BITS)) & 0xFFFF); };
+
+    groups_t groups{};
+    groups[TCLTC_GROUP_HRS] = lane(3);
+    groups[TCLTC_GROUP_MINS] = lane(2);
+    groups[TCLTC_GROUP_SECS] = lane(1);
+    groups[TCLTC_GROUP_FRAMES] = lane(0);
+
+    const auto tc = TTimecode::from_groups(groups, fps);
+    if (!tc) return failure{ tc.error() };
+
+    const __LtcFlagLayout& layout = __ltc_flag_layout(timebase);
+    __LtcFields fields{};
+    fields.user_bits = __ltc_gather_user_bits(data);
+    fields.binary_group_flags = static_cast<std::uint8_t>(std::uint8_t{ __ltc_test_bit(data, layout.binary_group_flags[0]) }
+                                                        | (std::uint8_t{ __ltc_test_bit(data, layout.binary_group_flags[1]) } << 1)
+                                                        | (std::uint8_t{ __ltc_test_bit(data, layout.binary_group_flags[2]) } << 2));
+    fields.color_frame = __ltc_test_bit(data, TCLTC_COLOR_FRAME_BIT);
+    fields.drop_frame = drop_frame;
+    fields.polarity_correction = __ltc_test_bit(data, layout.polarity_correction);
+
+    return __LtcFrame<TTimecode>{ tc.value(), fields };
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  @SECTION LTC Batches
+//
+///////////////////////////////////////////////////////////////////////////
+
+template<typename TTimecode>
+static constexpr void __encode_ltc_batch(std::span<const TTimecode> timecodes,
+                                         std::span<const __LtcFields> fields,
+                                         std::span<__LtcCodeword> codewords)
+{
+    assert(fields.size() >= timecodes.size() && "fields span of cxxtc::chrono::internal::__encode_ltc_batch is too small");
+    assert(codewords.size() >= timecodes.size() && "output span of cxxtc::chrono::internal::__encode_ltc_batch is too small");
+
+    for (std::size_t i = 0; i < timecodes.size(); ++i) codewords[i] = __encode_ltc(timecodes[i], fields[i]);
+}
+
+// Decodes every codeword at one rate. Bit i % 64 of valid[i / 64] is set for each
+// codeword that decodes, the others get a zero timecode and empty fields. Returns
+// the number that decode.
+template<typename TTimecode>
+static constexpr auto __decode_ltc_batch(std::span<const __LtcCodeword> codewords,
+                                         const typename TTimecode::fps_scalar_t fps,
+                                         std::span<TTimecode> timecodes,
+                                         std::span<__LtcFields> fields,
+                                         std::span<std::uint64_t> valid) -> std::size_t
+{
+    assert(timecodes.size() >= codewords.size() && "timecode span of cxxtc::chrono::internal::__decode_ltc_batch is too small");
+    assert(fields.size() >= codewords.size() && "fields span of cxxtc::chrono::internal::__decode_ltc_batch is too small");
+    assert(valid.size() * 64 >= codewords.size() && "valid span of cxxtc::chrono::internal::__decode_ltc_batch is too small");
+
+    const __LtcFrame<TTimecode> empty{ TTimecode{ 0, fps }, __LtcFields{} };
+    std::fill(valid.begin(), valid.end(), std::uint64_t{ 0 });
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < codewords.size(); ++i) {
+        const auto frame = __decode_ltc<TTimecode>(codewords[i], fps);
+        const bool ok = frame.has_value();
+        const __LtcFrame<TTimecode>& result = (ok) ? frame.value() : empty;
+
+        timecodes[i] = result.tc;
+        fields[i] = result.fields;
+        valid[i / 64] |= std::uint64_t{ ok } << (i % 64);
+        count += ok;
+    }
+
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+#undef TCLTC_SYNC_WORD
+#undef TCLTC_SYNC_ONES
+#undef TCLTC_CODEWORD_BYTES
+#undef TCLTC_TIMEBASE_MAX
+#undef TCLTC_HOURS_PER_DAY
+#undef TCLTC_DROP_FRAME_BIT
+#undef TCLTC_COLOR_FRAME_BIT
+#undef TCLTC_USER_BITS_SHIFT
+#undef TCLTC_LANE_UNITS
+#undef TCLTC_LANE_TENS
+#undef TCLTC_LANE_DIGIT_CARRY
+#undef TCLTC_LANE_DIGIT_OVERFLOW
+#undef TCLTC_LANE_BITS
+#undef TCLTC_GROUP_HRS
+#undef TCLTC_GROUP_MINS
+#undef TCLTC_GROUP_SECS
+#undef TCLTC_GROUP_FRAMES
+
+} // @END OF namespace cxxtc::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
@@ -8,6 +8,7 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // Standard header
+#include <chrono>
 #include <concepts>
 #include <cstdio>
 #include <iostream>
@@ -77,6 +78,12 @@ concept DefaultableEnum = magic_enum::is_unscoped_enum_v<T>
                               T::none;
                           };
 
+// std::chrono::duration with an integer count, e.g. std::chrono::nanoseconds
+template<typename T>
+concept IntegralDuration = requires { typename T::rep; typename T::period; }
+                        && std::same_as<T, std::chrono::duration<typename T::rep, typename T::period>>
+                        && std::integral<typename T::rep>;
+
 template<typename T, typename O>
 concept SameAsReturn = std::same_as<std::invoke_result_t<T>, O>;
 
@@ -117,6 +124,14 @@ template<typename T>
 concept StringConstructible = AssignableFrom<T, const char*, std::string, std::string_view>
                            && ConvertibleFrom<T, const char*, std::string, std::string_view>;
 
+// char types other than char whose labels are read and written through the
+// narrow kernels
+template<typename T>
+concept WideCharType = std::same_as<T, wchar_t>
+                    || std::same_as<T, char8_t>
+                    || std::same_as<T, char16_t>
+                    || std::same_as<T, char32_t>;
+
 template<typename T>
 concept StdStringInterface = std::same_as<T, std::string>
                           || std::same_as<T, std::wstring>
@@ -8,13 +8,22 @@
 // Standard library
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <cassert>
+#include <compare>
 #include <cstdint>
 #include <concepts>
+#include <limits>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <tuple>
 #include <utility>
+#include <version>
+
+#if defined(__cpp_lib_expected)
+#include <expected>
+#endif
 
 // Third-party library
 #include <magic_enum.hpp>
@@ -31,8 +40,8 @@
 
 #define VTM_BIGARRAY_SIZE (10 * 1024 * 1024)
 
-#define GET_ENUM_MAPPING_1(M, I) std::get<0>(M)(I)
-#define GET_ENUM_MAPPING_2(M, I) std::get<1>(M)(I)
+#define GET_ENUM_MAPPING_1(M, I) (M).to_value(I)
+#define GET_ENUM_MAPPING_2(M, I) (M).to_enum(I)
 #define DECLARE_ENUM_MAPPING(T1, T2, ...) cxxtc::utility::internal::enum_map<T1, T2>(__VA_ARGS__)
 #define DECLARE_ENUM_MAPPING_BOOL(T1, T2, ...) cxxtc::utility::internal::enum_map<T1, T2>(__VA_ARGS__)
 
@@ -125,54 +134,112 @@ consteval auto to_string_view(Callable callable) -> std::remove_cvref_t<TView>
     return view_t{static_data.begin(), static_data.end()};
 }
 
-template<cxxtc::traits::DefaultableEnum In,
-         std::semiregular Out,
-         cxxtc::traits::SameAsReturn<Out>... Mappings>
-inline consteval auto map_enum_values(std::invocable auto&& report_enum,
-                                      std::invocable auto&& report_out,
-                                      In&& default_enum,
-                                      Out&& default_out,
-                                      Mappings&&... mappings)
-{
-    const auto options = magic_enum::enum_values<In>();
-    const std::array values{ std::forward<Out>(mappings())... };
-
-    return std::make_tuple (
-        [=](const In& in) {
-            std::size_t i = 0;
-            for (const auto& o : options) {
-                if (o == in) return values[i];
-                ++i;
-            }
-            report_enum();
-            return default_out;
-        },
-
-        [=](const Out& in) {
-            std::size_t i = 0;
-            for (const auto& v : values) {
-                if (v == in) return options[i];
-                ++i;
-            }
-            report_out();
-            return default_enum;
+// key used to hash a mapped value: integers by value, floating points by their bit
+// pattern and strings with FNV-1a over their characters
+template<typename T>
+constexpr auto enum_map_key(const T& value) -> std::uint64_t
+{
+    if constexpr (std::integral<T>) {
+        return static_cast<std::uint64_t>(value);
+    }
+
+    else if constexpr (std::floating_point<T>) {
+        return std::bit_cast<std::uint64_t>(static_cast<double>(value));
+    }
+
+    else {
+        std::uint64_t hash = 0xcbf29ce484222325;
+        for (const auto c : value) {
+            hash ^= static_cast<std::uint64_t>(c);
+            hash *= 0x100000001b3;
         }
-    );
+
+        return hash;
+    }
 }
 
-template<cxxtc::traits::DefaultableEnum In, typename Out, typename... OutArgs>
-consteval auto enum_map(std::invocable auto report_enum,
-                        std::invocable auto report_out,
-                        In default_enum,
-                        Out default_out,
-                        OutArgs... mappings)
+// Two-way mapping between an enumeration and a value type. Forward lookups index a
+// dense array by the enumeration value, reverse lookups go through a perfect hash that
+// is searched at compile time. Neither direction scans, reports or allocates; a miss
+// returns the default of the other side.
+template<cxxtc::traits::DefaultableEnum In, std::semiregular Out, std::size_t N>
+struct dense_enum_map
 {
-    static_assert(sizeof...(mappings) == magic_enum::enum_count<In>() - 1, "count of enumeration mappings must be exactly the same as mapping values");
-    return map_enum_values<In, Out>(std::move(report_enum),
-                                    std::move(report_out),
-                                    std::move(default_enum),
-                                    std::move(default_out),
-                                    [=]() { return Out{std::move(mappings)}; }...);
+    static constexpr std::size_t hash_bits = std::bit_width(N * 2);
+    static constexpr std::size_t hash_size = std::size_t{1} << hash_bits;
+
+    static_assert(N < std::numeric_limits<std::uint8_t>::max(), "enumeration is too large for dense_enum_map slots");
+
+    std::array<Out, N> values{};
+    std::array<std::uint8_t, hash_size> slots{}; // index + 1 of the value hashed to each slot, 0 when empty
+    std::uint64_t seed = 0;
+    In default_enum{};
+    Out default_out{};
+
+    static constexpr auto hash(const std::uint64_t key, const std::uint64_t seed) -> std::size_t
+    {
+        return static_cast<std::size_t>(((key ^ seed) * 0x9e3779b97f4a7c15) >> (64 - hash_bits));
+    }
+
+    constexpr auto to_value(const In in) const -> Out
+    {
+        const auto index = static_cast<std::size_t>(in);
+        return (index < N) ? this->values[index] : this->default_out;
+    }
+
+    constexpr auto to_enum(const Out& out) const -> In
+    {
+        const std::size_t slot = this->slots[hash(enum_map_key(out), this->seed)];
+        return (slot != 0 && this->values[slot - 1] == out) ? static_cast<In>(slot - 1) : this->default_enum;
+    }
+};
+
+template<cxxtc::traits::DefaultableEnum In, std::semiregular Out, typename... OutArgs>
+consteval auto enum_map(In default_enum, Out default_out, OutArgs... mappings)
+{
+    constexpr auto options = magic_enum::enum_values<In>();
+    constexpr std::size_t size = options.size();
+    using map_t = dense_enum_map<In, Out, size>;
+
+    static_assert(sizeof...(mappings) == size - 1, "count of enumeration mappings must be exactly the same as mapping values");
+    static_assert([]() {
+        const auto options = magic_enum::enum_values<In>();
+        for (std::size_t i = 0; i < options.size(); ++i) {
+            if (static_cast<std::size_t>(options[i]) != i) return false;
+        }
+        return true;
+    }(), "values of the enumeration must be contiguous from zero to index the mapping");
+
+    map_t map{};
+    map.default_enum = default_enum;
+    map.default_out = default_out;
+
+    // mapping values are given in enumeration order, skipping the default enumeration
+    const std::array<Out, size - 1> mapped{ Out{mappings}... };
+    for (std::size_t i = 0, m = 0; i < size; ++i) {
+        map.values[i] = (options[i] == default_enum) ? default_out : mapped[m++];
+    }
+
+    // search for a seed that hashes every distinct value to its own slot; duplicate
+    // values keep the first enumeration that maps to them
+    for (std::uint64_t seed = 0;; ++seed) {
+        std::array<std::uint8_t, map_t::hash_size> slots{};
+        bool collision = false;
+
+        for (std::size_t i = 0; i < size && !collision; ++i) {
+            if (std::find(map.values.begin(), std::next(map.values.begin(), i), map.values[i]) != std::next(map.values.begin(), i)) continue;
+
+            auto& slot = slots[map_t::hash(enum_map_key(map.values[i]), seed)];
+            collision = (slot != 0);
+            slot = static_cast<std::uint8_t>(i + 1);
+        }
+
+        if (!collision) {
+            map.seed = seed;
+            map.slots = slots;
+            return map;
+        }
+    }
 }
 
 } // @END OF namespace cxxtc::utility::internal
@@ -233,3 +300,328 @@ consteval auto map_integer_sequence(F f,
 } // @END OF namespace cxxtc::utility
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cxxtc::utility::internal {
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 __uint128_type;
+#endif
+
+constexpr auto mulhi(const std::uint64_t a, const std::uint64_t b) noexcept -> std::uint64_t
+{
+#if defined(__SIZEOF_INT128__)
+    return static_cast<std::uint64_t>((static_cast<__uint128_type>(a) * b) >> 64);
+#else
+    const std::uint64_t a_lo = a & 0xffffffff, a_hi = a >> 32;
+    const std::uint64_t b_lo = b & 0xffffffff, b_hi = b >> 32;
+
+    const std::uint64_t lo_lo = a_lo * b_lo;
+    const std::uint64_t hi_lo = a_hi * b_lo;
+    const std::uint64_t lo_hi = a_lo * b_hi;
+    const std::uint64_t hi_hi = a_hi * b_hi;
+
+    const std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+    return (cross >> 32) + (hi_lo >> 32) + hi_hi;
+#endif
+}
+
+// floor((hi * 2^64 + lo) / d) for hi < d
+constexpr auto divide_128_by_64(std::uint64_t hi, std::uint64_t lo, const std::uint64_t d) noexcept -> std::uint64_t
+{
+#if defined(__SIZEOF_INT128__)
+    if (!std::is_constant_evaluated()) {
+        return static_cast<std::uint64_t>(((static_cast<__uint128_type>(hi) << 64) | lo) / d);
+    }
+#endif
+
+    std::uint64_t quotient = 0;
+    for (int bit = 63; bit >= 0; --bit) {
+        const bool carry = (hi >> 63) != 0;
+        hi = (hi << 1) | (lo >> 63);
+        lo <<= 1;
+
+        if (carry || hi >= d) {
+            hi -= d;
+            quotient |= (std::uint64_t{1} << bit);
+        }
+    }
+
+    return quotient;
+}
+
+// floor((a * b) / d) without overflowing the intermediate product, the quotient
+// itself must fit in 64 bits
+constexpr auto muldiv(const std::uint64_t a, const std::uint64_t b, const std::uint64_t d) noexcept -> std::uint64_t
+{
+    assert(d > 0 && mulhi(a, b) < d && "quotient of cxxtc::utility::internal::muldiv does not fit in 64 bits");
+    return divide_128_by_64(mulhi(a, b), a * b, d);
+}
+
+// (a * b) mod d without overflowing the intermediate product
+constexpr auto mulmod(const std::uint64_t a, const std::uint64_t b, const std::uint64_t d) noexcept -> std::uint64_t
+{
+    assert(d > 0 && "modulus of cxxtc::utility::internal::mulmod must be greater than zero");
+    const std::uint64_t quotient = divide_128_by_64(mulhi(a, b) % d, a * b, d);
+    return (a * b) - (quotient * d);
+}
+
+// orders the exact products a * b and c * d without overflowing either of them
+constexpr auto compare_products(const std::uint64_t a, const std::uint64_t b,
+                                const std::uint64_t c, const std::uint64_t d) noexcept -> std::strong_ordering
+{
+    const std::uint64_t lhs_hi = mulhi(a, b);
+    const std::uint64_t rhs_hi = mulhi(c, d);
+    return (lhs_hi != rhs_hi) ? (lhs_hi <=> rhs_hi) : ((a * b) <=> (c * d));
+}
+
+// Overflow-checked arithmetic on an unsigned value and any integral operand: the
+// result is the wrapped value and the return value reports whether the exact result
+// did not fit. Uses the compiler builtins when they are available.
+template<std::unsigned_integral T, std::integral U>
+constexpr auto sub_overflow(const T a, const U b, T& result) noexcept -> bool
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_sub_overflow(a, b, &result);
+#else
+    static_assert(sizeof(U) <= sizeof(T), "operand of cxxtc::utility::internal::sub_overflow is wider than the result");
+
+    const T magnitude = (b < 0) ? (T{0} - static_cast<T>(b)) : static_cast<T>(b);
+    if (b < 0) {
+        result = a + magnitude;
+        return result < a;
+    }
+
+    result = a - magnitude;
+    return magnitude > a;
+#endif
+}
+
+template<std::unsigned_integral T, std::integral U>
+constexpr auto add_overflow(const T a, const U b, T& result) noexcept -> bool
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_add_overflow(a, b, &result);
+#else
+    static_assert(sizeof(U) <= sizeof(T), "operand of cxxtc::utility::internal::add_overflow is wider than the result");
+
+    const T magnitude = (b < 0) ? (T{0} - static_cast<T>(b)) : static_cast<T>(b);
+    if (b < 0) {
+        result = a - magnitude;
+        return magnitude > a;
+    }
+
+    result = a + magnitude;
+    return result < a;
+#endif
+}
+
+template<std::unsigned_integral T, std::integral U>
+constexpr auto mul_overflow(const T a, const U b, T& result) noexcept -> bool
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_mul_overflow(a, b, &result);
+#else
+    static_assert(sizeof(U) <= sizeof(T), "operand of cxxtc::utility::internal::mul_overflow is wider than the result");
+
+    result = a * static_cast<T>(b);
+    if (b < 0) return a != 0;
+    return mulhi(a, static_cast<T>(b)) != 0;
+#endif
+}
+
+} // @END OF namespace cxxtc::utility::internal
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cxxtc::utility {
+
+// Precomputed reciprocal for dividing by a divisor that is only known at run time,
+// in the style of libdivide: a 64-bit multiply-high, a subtract and two shifts
+// instead of a hardware divide. Powers of two reduce to a single shift.
+struct fast_divisor
+{
+    std::uint64_t divisor = 1;
+    std::uint64_t multiplier = 0;
+    std::uint8_t shift = 0;
+
+    constexpr fast_divisor() = default;
+
+    constexpr explicit fast_divisor(const std::uint64_t d)
+        : divisor(d)
+    {
+        assert(d > 0 && d <= (std::uint64_t{1} << 63)
+               && "divisor of cxxtc::utility::fast_divisor must be in the range [1, 2^63]");
+
+        const auto log2_ceil = static_cast<std::uint8_t>(std::bit_width(d - 1));
+        if (std::has_single_bit(d)) {
+            this->shift = log2_ceil;
+            return;
+        }
+
+        const std::uint64_t hi = (std::uint64_t{1} << log2_ceil) - d;
+        this->multiplier = internal::divide_128_by_64(hi, 0, d) + 1;
+        this->shift = log2_ceil - 1;
+    }
+
+    constexpr auto divide(const std::uint64_t n) const noexcept -> std::uint64_t
+    {
+        if (this->multiplier == 0) return n >> this->shift;
+
+        const std::uint64_t q = internal::mulhi(this->multiplier, n);
+        return (((n - q) >> 1) + q) >> this->shift;
+    }
+
+    constexpr auto remainder(const std::uint64_t n) const noexcept -> std::uint64_t
+    {
+        return n - (this->divide(n) * this->divisor);
+    }
+};
+
+// Fixed-capacity string held inline, for short text that is passed around, stored
+// in structs and sent across threads without an allocator. Trivially copyable and
+// always null-terminated when shorter than the capacity. Small capacities keep the
+// size in one byte, static_string<15> is 16 bytes.
+template<std::size_t N, typename TChar = char>
+class static_string
+{
+public:
+    using value_type = TChar;
+    using size_type = std::conditional_t<(N <= std::numeric_limits<std::uint8_t>::max()), std::uint8_t, std::size_t>;
+    using view_type = std::basic_string_view<TChar>;
+
+    constexpr static_string() noexcept = default;
+
+    constexpr static_string(const TChar* chars, const std::size_t size) noexcept
+        : _size(static_cast<size_type>(size))
+    {
+        assert(size <= N && "size of text in cxxtc::utility::static_string must be at most its capacity");
+        for (std::size_t i = 0; i < size; ++i) this->_data[i] = chars[i];
+    }
+
+    constexpr explicit static_string(const view_type text) noexcept
+        : static_string(text.data(), text.size())
+    {}
+
+    static constexpr auto capacity() noexcept -> std::size_t { return N; }
+
+    constexpr auto size() const noexcept -> std::size_t { return this->_size; }
+    constexpr auto length() const noexcept -> std::size_t { return this->_size; }
+    constexpr bool empty() const noexcept { return this->_size == 0; }
+
+    constexpr auto data() const noexcept -> const TChar* { return this->_data.data(); }
+    constexpr auto begin() const noexcept -> const TChar* { return this->_data.data(); }
+    constexpr auto end() const noexcept -> const TChar* { return this->_data.data() + this->_size; }
+    constexpr auto operator[](const std::size_t i) const noexcept -> TChar { return this->_data[i]; }
+
+    constexpr auto view() const noexcept -> view_type { return view_type{ this->data(), this->size() }; }
+    constexpr operator view_type() const noexcept { return this->view(); }
+
+    friend constexpr bool operator==(const static_string& a, const static_string& b) noexcept
+    {
+        return a.view() == b.view();
+    }
+
+    friend constexpr auto operator<=>(const static_string& a, const static_string& b) noexcept
+    {
+        return a.view() <=> b.view();
+    }
+
+private:
+    std::array<TChar, N> _data{};
+    size_type _size = 0;
+};
+
+#if defined(__cpp_lib_expected)
+template<typename T, typename E>
+using expected = std::expected<T, E>;
+
+template<typename E>
+using unexpected = std::unexpected<E>;
+#else
+// The part of std::expected the library returns, for standard libraries without
+// <expected>. Only holds trivially destructible types, which is all it is used for.
+template<typename E>
+class unexpected
+{
+public:
+    constexpr explicit unexpected(const E& error) noexcept
+        : _error(error)
+    {}
+
+    constexpr auto error() const noexcept -> const E& { return this->_error; }
+
+private:
+    E _error;
+};
+
+template<typename T, typename E>
+class expected
+{
+    static_assert(std::is_trivially_destructible_v<T> && std::is_trivially_destructible_v<E>,
+                  "cxxtc::utility::expected only holds trivially destructible types");
+
+public:
+    using value_type = T;
+    using error_type = E;
+
+    constexpr expected(const T& value) noexcept
+        : _value(value)
+        , _has_value(true)
+    {}
+
+    constexpr expected(const unexpected<E>& error) noexcept
+        : _error(error.error())
+        , _has_value(false)
+    {}
+
+    constexpr bool has_value() const noexcept { return this->_has_value; }
+    constexpr explicit operator bool() const noexcept { return this->_has_value; }
+
+    constexpr auto value() const -> const T&
+    {
+        assert(this->_has_value && "value of cxxtc::utility::expected accessed while it holds an error");
+        return this->_value;
+    }
+
+    constexpr auto error() const -> const E&
+    {
+        assert(!this->_has_value && "error of cxxtc::utility::expected accessed while it holds a value");
+        return this->_error;
+    }
+
+    constexpr auto operator*() const -> const T& { return this->value(); }
+    constexpr auto operator->() const -> const T* { return &this->value(); }
+
+    template<typename U>
+    constexpr auto value_or(U&& fallback) const -> T
+    {
+        return (this->_has_value) ? this->_value : static_cast<T>(std::forward<U>(fallback));
+    }
+
+private:
+    union {
+        T _value;
+        E _error;
+    };
+
+    bool _has_value;
+};
+#endif // @END OF __cpp_lib_expected
+
+} // @END OF namespace cxxtc::utility
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef ENABLE_STATIC_TESTS
+
+static_assert(cxxtc::utility::fast_divisor(1).divide(42) == 42, "cxxtc::utility::fast_divisor does not divide by one");
+static_assert(cxxtc::utility::fast_divisor(64).divide(4095) == 63, "cxxtc::utility::fast_divisor does not divide by powers of two");
+static_assert(cxxtc::utility::fast_divisor(7).divide(0xffffffffffffffff) == 0xffffffffffffffff / 7, "cxxtc::utility::fast_divisor does not divide the full 64-bit range");
+static_assert(cxxtc::utility::fast_divisor(8640000).divide(8639999) == 0, "cxxtc::utility::fast_divisor does not round towards zero");
+static_assert(cxxtc::utility::fast_divisor(8640000).remainder(8640001) == 1, "cxxtc::utility::fast_divisor does not compute remainders");
+static_assert(cxxtc::utility::internal::muldiv(1ULL << 40, 1001000000000, 3000000) == 366870379801258666, "cxxtc::utility::internal::muldiv does not keep the full product");
+static_assert(std::is_lt(cxxtc::utility::internal::compare_products(1ULL << 40, 1ULL << 30, 1ULL << 35, (1ULL << 35) + 1)), "cxxtc::utility::internal::compare_products does not compare the high words");
+
+#endif // @END OF ENABLE_STATIC_TESTS
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
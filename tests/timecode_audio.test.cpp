@@ -0,0 +1,191 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Static Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#ifdef ENABLE_STATIC_TESTS
+
+// conditions for static tests
+static_assert(cxxtc::to_samples(cxxtc::timecode{ 90000 * 100, cxxtc::fps::fps_25 }, cxxtc::sample_rates::khz_48) == 172800000, "cxxtc::to_samples does not convert at compile time");
+static_assert(cxxtc::from_samples(48048000, cxxtc::sample_rates::khz_48, cxxtc::fps::fps_29p97).ticks() == 30000 * 100, "cxxtc::from_samples does not convert at compile time");
+static_assert(cxxtc::cadence(cxxtc::fps::fps_29p97, cxxtc::sample_rates::khz_48).size() == 5, "cxxtc::cadence of 48 kHz at 29.97 is not five frames");
+static_assert(cxxtc::cadence(cxxtc::fps::fps_29p97, cxxtc::sample_rates::khz_47p952).size() == 1, "cxxtc::cadence of pulled down 48 kHz at 29.97 is not whole samples per frame");
+
+#endif // @END OF ENABLE_STATIC_TESTS
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Sample Position Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::to_samples converts timecodes to sample positions", "[timecode][chrono][audio]")
+{
+    SECTION("sample positions of known timecodes") {
+        // source objects
+        const cxxtc::timecode tc1{ "01:00:00:00", cxxtc::fps::fps_25 };
+        const cxxtc::timecode tc2{ 30000 * 100, cxxtc::fps::fps_29p97 };
+        const cxxtc::timecode tc3{ 24000 * 100, cxxtc::fps::fps_23p976 };
+        const cxxtc::timecode tc4{ 1 * 100, cxxtc::fps::fps_29p97 };
+
+        // conditions for test
+        INFO("tc1 48k: " << cxxtc::to_samples(tc1, cxxtc::sample_rates::khz_48));         CHECK(cxxtc::to_samples(tc1, cxxtc::sample_rates::khz_48) == 172800000);
+        INFO("tc1 192k: " << cxxtc::to_samples(tc1, cxxtc::sample_rates::khz_192));       CHECK(cxxtc::to_samples(tc1, cxxtc::sample_rates::khz_192) == 691200000);
+        INFO("tc2 48k: " << cxxtc::to_samples(tc2, cxxtc::sample_rates::khz_48));         CHECK(cxxtc::to_samples(tc2, cxxtc::sample_rates::khz_48) == 48048000);
+        INFO("tc2 47.952k: " << cxxtc::to_samples(tc2, cxxtc::sample_rates::khz_47p952)); CHECK(cxxtc::to_samples(tc2, cxxtc::sample_rates::khz_47p952) == 48000000);
+        INFO("tc3 44.1k: " << cxxtc::to_samples(tc3, cxxtc::sample_rates::khz_44p1));     CHECK(cxxtc::to_samples(tc3, cxxtc::sample_rates::khz_44p1) == 44144100);
+        INFO("tc3 44.056k: " << cxxtc::to_samples(tc3, cxxtc::sample_rates::khz_44p056)); CHECK(cxxtc::to_samples(tc3, cxxtc::sample_rates::khz_44p056) == 44100000);
+        INFO("tc1 48.048k: " << cxxtc::to_samples(tc1, cxxtc::sample_rates::khz_48p048)); CHECK(cxxtc::to_samples(tc1, cxxtc::sample_rates::khz_48p048) == 172972800);
+        CHECK(cxxtc::to_samples(tc4, cxxtc::sample_rates::khz_48, cxxtc::rounding::down) == 1601);
+        CHECK(cxxtc::to_samples(tc4, cxxtc::sample_rates::khz_48, cxxtc::rounding::nearest) == 1602);
+    }
+
+    SECTION("sample positions convert back to the same tick for every rate") {
+        // source objects
+        const std::array<cxxtc::fps::type, 5> rates {
+            cxxtc::fps::fps_23p976, cxxtc::fps::fps_25, cxxtc::fps::fpsdf_29p97, cxxtc::fps::fps_50, cxxtc::fps::fpsdf_59p94
+        };
+        const std::array<cxxtc::sample_rate, 4> sample_rates {
+            cxxtc::sample_rates::khz_44p1, cxxtc::sample_rates::khz_47p952, cxxtc::sample_rates::khz_48, cxxtc::sample_rates::khz_96
+        };
+
+        // conditions for test
+        for (const auto rate : rates) {
+            for (const auto sample_rate : sample_rates) {
+                for (std::uint64_t ticks = 0; ticks < 100000000; ticks += 791903) {
+                    const cxxtc::timecode tc{ ticks, rate };
+                    const cxxtc::timecode result = cxxtc::from_samples(cxxtc::to_samples(tc, sample_rate), sample_rate, rate);
+                    INFO("ticks: " << ticks << ", sample rate: " << sample_rate.numerator << "/" << sample_rate.denominator);
+                    REQUIRE(result.ticks() == tc.ticks());
+                    REQUIRE(result.fps() == rate);
+                }
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Sample Cadence Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::cadence gives the samples in each frame", "[timecode][chrono][audio][cadence]")
+{
+    SECTION("48 kHz at 29.97 is the five frame SMPTE cadence") {
+        // source objects
+        const cxxtc::sample_cadence cadence = cxxtc::cadence(cxxtc::fps::fps_29p97, cxxtc::sample_rates::khz_48);
+        const std::array<std::uint32_t, 5> expected { 1602, 1601, 1602, 1601, 1602 };
+        std::array<std::uint32_t, 10> counts{};
+
+        // pre-conditions for test
+        cadence.fill(0, counts);
+
+        // conditions for test
+        CHECK(cadence.size() == 5);
+        CHECK(cadence.cycle_samples() == 8008);
+        for (std::size_t i = 0; i < counts.size(); ++i) {
+            INFO("frame: " << i);
+            CHECK(counts[i] == expected[i % expected.size()]);
+            CHECK(cadence[i] == expected[i % expected.size()]);
+        }
+    }
+
+    SECTION("cadences of other rates") {
+        // source objects
+        const cxxtc::sample_cadence cadence1 = cxxtc::cadence(cxxtc::fps::fps_25, cxxtc::sample_rates::khz_48);
+        const cxxtc::sample_cadence cadence2 = cxxtc::cadence(cxxtc::fps::fps_23p976, cxxtc::sample_rates::khz_44p1);
+        const cxxtc::sample_cadence cadence3 = cxxtc::cadence(cxxtc::fps::fps_59p94, cxxtc::sample_rates::khz_48);
+
+        // conditions for test
+        INFO("cadence1 size: " << cadence1.size()); CHECK(cadence1.size() == 1); CHECK(cadence1[12345] == 1920);
+        INFO("cadence2 size: " << cadence2.size()); CHECK(cadence2.size() == 80); CHECK(cadence2.cycle_samples() == 147147);
+        INFO("cadence3 size: " << cadence3.size()); CHECK(cadence3.size() == 5); CHECK(cadence3.cycle_samples() == 4004);
+    }
+
+    SECTION("frame starts match sample positions with nearest rounding") {
+        // source objects
+        const std::array<cxxtc::fps::type, 3> rates { cxxtc::fps::fps_23p976, cxxtc::fps::fps_29p97, cxxtc::fps::fps_59p94 };
+
+        // conditions for test
+        for (const auto rate : rates) {
+            const cxxtc::sample_cadence cadence = cxxtc::cadence(rate, cxxtc::sample_rates::khz_44p1);
+            std::uint64_t start = 0;
+
+            for (std::uint64_t frame = 0; frame < 5000; ++frame) {
+                const cxxtc::timecode tc{ frame * 100, rate };
+                INFO("frame: " << frame);
+                REQUIRE(cadence.frame_start(frame) == start);
+                REQUIRE(cxxtc::to_samples(tc, cxxtc::sample_rates::khz_44p1) == start);
+                start += cadence[frame];
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Batch Conversion Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("batch sample conversions match the single conversions", "[timecode][chrono][audio][batch]")
+{
+    SECTION("timecodes of mixed rates") {
+        // source objects
+        std::vector<cxxtc::timecode> timecodes;
+        for (std::uint64_t i = 0; i < 1000; ++i) {
+            const cxxtc::fps::type rate = (i / 100) % 2 == 0 ? cxxtc::fps::fps_29p97 : cxxtc::fps::fps_25;
+            timecodes.emplace_back((i * 7919) + 12345, rate);
+        }
+
+        std::vector<std::uint64_t> samples(timecodes.size());
+
+        // pre-conditions for test
+        cxxtc::to_samples(timecodes, cxxtc::sample_rates::khz_48, samples);
+
+        // conditions for test
+        for (std::size_t i = 0; i < timecodes.size(); ++i) {
+            INFO("index: " << i);
+            REQUIRE(samples[i] == cxxtc::to_samples(timecodes[i], cxxtc::sample_rates::khz_48));
+        }
+    }
+
+    SECTION("sample positions at one rate") {
+        // source objects
+        std::vector<std::uint64_t> samples;
+        for (std::uint64_t i = 0; i < 1000; ++i) samples.push_back(i * 104729);
+
+        std::vector<cxxtc::timecode> timecodes(samples.size());
+
+        // pre-conditions for test
+        cxxtc::from_samples(samples, cxxtc::sample_rates::khz_96, cxxtc::fps::fps_23p976, timecodes);
+
+        // conditions for test
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            const cxxtc::timecode expected = cxxtc::from_samples(samples[i], cxxtc::sample_rates::khz_96, cxxtc::fps::fps_23p976);
+            INFO("index: " << i);
+            REQUIRE(timecodes[i].ticks() == expected.ticks());
+            REQUIRE(timecodes[i].fps() == cxxtc::fps::fps_23p976);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
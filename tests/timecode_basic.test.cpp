@@ -1,8 +1,14 @@
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch_all.hpp>
 #include "timecode.hpp"
+#include <array>
+#include <chrono>
+#include <iterator>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////
 //
@@ -11,41 +17,32 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #ifdef ENABLE_STATIC_TESTS
-#define TOTAL_SCALAR_GROUPS 5
-
-// static helpers
-consteval int to_nearest_padding(int size, int alignment)
-{
-    int boundary = 0;
-    while (boundary < size) {
-        boundary += alignment;
-    }
-
-    return boundary - size;
-}
-
-consteval int size_of_cxxtctimecode()
-{
-#if defined(_WIN32)
-    constexpr int size = (sizeof(cxxtc::timecode::scalar_t) * TOTAL_SCALAR_GROUPS) +
-                          sizeof(cxxtc::timecode::fps_scalar_t) +
-                          sizeof(cxxtc::timecode::flags_t) +
-                          sizeof(void*);
-#elif defined(__linux__) || defined(__gnu_linux__)
-    constexpr int size = (sizeof(cxxtc::timecode::scalar_t) * TOTAL_SCALAR_GROUPS) +
-                          sizeof(cxxtc::timecode::fps_scalar_t) +
-                          sizeof(cxxtc::timecode::flags_t);
-#endif
-
-    constexpr int padding = to_nearest_padding(size, alignof(cxxtc::timecode));
-
-    return size + padding;
-}
 
 // conditions for static tests
-static_assert(sizeof(cxxtc::timecode) == size_of_cxxtctimecode(), "size of cxxtc::timecode object does not meet established size requirements");
+static_assert(sizeof(cxxtc::timecode) <= 8, "size of cxxtc::timecode object does not meet established size requirements");
+static_assert(sizeof(cxxtc::basic_timecode<cxxtc::fps_constant<cxxtc::fps::fps_25>>) <= 8, "size of compile-time fps cxxtc::basic_timecode object does not meet established size requirements");
+static_assert(std::is_trivially_copyable_v<cxxtc::timecode>, "cxxtc::timecode is not trivially copyable");
+static_assert(std::is_trivially_copy_constructible_v<cxxtc::timecode> && std::is_trivially_move_constructible_v<cxxtc::timecode>,
+              "copies and moves of cxxtc::timecode are not trivial");
+static_assert(std::is_trivially_copy_assignable_v<cxxtc::timecode> && std::is_trivially_move_assignable_v<cxxtc::timecode>,
+              "copy and move assignment of cxxtc::timecode are not trivial");
+static_assert(std::is_trivially_copyable_v<cxxtc::timecode::static_string_t> && sizeof(cxxtc::timecode::static_string_t) == 16,
+              "static string of cxxtc::timecode is not a trivially copyable 16 bytes");
+
+// timecode literals are parsed during compilation
+using namespace cxxtc::literals;
+static_assert(("01:00:00:00"_tc25).ticks() == 90000 * 100, "cxxtc timecode literal is not folded at compile time");
+static_assert(("00:59:59;29"_tcdf).ticks() == (107892 - 1) * 100, "cxxtc drop-frame timecode literal is not folded at compile time");
+static_assert(("00:59:59;29"_tcdf).as_static_string().view() == "00:59:59;29", "cxxtc::timecode::as_static_string does not format at compile time");
+
+// checked parsing works during compilation
+static_assert(cxxtc::parse("01:00:00:00", cxxtc::fps::fps_25)->ticks() == 90000 * 100, "cxxtc::parse does not parse at compile time");
+static_assert(cxxtc::parse("01:00:00:25", cxxtc::fps::fps_25).error() == cxxtc::parse_error::out_of_range, "cxxtc::parse does not check frames at compile time");
+static_assert(cxxtc::parse(u"01:00:00:00", cxxtc::fps::fps_25)->ticks() == 90000 * 100, "cxxtc::parse does not parse UTF-16 labels at compile time");
+static_assert(cxxtc::parse(U"00:01:00;00", cxxtc::fps::fpsdf_29p97).error() == cxxtc::parse_error::skipped_label, "cxxtc::parse does not check UTF-32 labels at compile time");
+static_assert(cxxtc::to_duration<std::chrono::microseconds>(cxxtc::timecode{ 100, cxxtc::fps::fps_23p976 }) == std::chrono::microseconds{ 41708 }, "cxxtc::to_duration does not convert at compile time");
+static_assert(cxxtc::from_duration(std::chrono::seconds{ 1001 }, cxxtc::fps::fps_23p976).ticks() == 24000 * 100, "cxxtc::from_duration does not convert at compile time");
 
-#undef TOTAL_SCALAR_GROUPS
 #endif // @END OF ENABLE_STATIC_TESTS
 
 ///////////////////////////////////////////////////////////////////////////
@@ -143,13 +140,13 @@ TEST_CASE("cxxtc::timecode initialization", "[timecode][chrono][initialization]"
         INFO("tc2 subframes: " << tc2.subframes()); CHECK(tc2.subframes() == 42);
         INFO("tc2 fps: "       << tc2.fps());       CHECK(tc2.fps()       == cxxtc::fps::fps_24);
 
-        // post-conditions for copy construction
-        INFO("tc1 hours: "     << tc1.hours());     CHECK(tc1.hours()     == 0);
-        INFO("tc1 minutes: "   << tc1.minutes());   CHECK(tc1.minutes()   == 0);
-        INFO("tc1 seconds: "   << tc1.seconds());   CHECK(tc1.seconds()   == 0);
-        INFO("tc1 frames: "    << tc1.frames());    CHECK(tc1.frames()    == 0);
-        INFO("tc1 subframes: " << tc1.subframes()); CHECK(tc1.subframes() == 0);
-        INFO("tc1 fps: "       << tc1.fps());       CHECK(tc1.fps()       == cxxtc::fps::default_value());
+        // post-conditions for move construction, moves are plain copies of the packed word
+        INFO("tc1 hours: "     << tc1.hours());     CHECK(tc1.hours()     == 42);
+        INFO("tc1 minutes: "   << tc1.minutes());   CHECK(tc1.minutes()   == 42);
+        INFO("tc1 seconds: "   << tc1.seconds());   CHECK(tc1.seconds()   == 42);
+        INFO("tc1 frames: "    << tc1.frames());    CHECK(tc1.frames()    == 23);
+        INFO("tc1 subframes: " << tc1.subframes()); CHECK(tc1.subframes() == 42);
+        INFO("tc1 fps: "       << tc1.fps());       CHECK(tc1.fps()       == cxxtc::fps::fps_24);
 
         // TODO: check flags
     }
@@ -370,6 +367,46 @@ TEST_CASE("cxxtc::timecode tick value representation", "[chrono][timecode][numbe
                                                                  5);
 
     }
+
+    SECTION("groups are derived from ticks for long durations") {
+        // source object
+        cxxtc::timecode tc1{ (300LL * 60 * 60 * 25 * 100) +
+                             (2 * 60 * 25 * 100) +
+                             (3 * 25 * 100) +
+                             (4 * 100) +
+                              5
+                           };
+
+        // pre-conditions for test
+        INFO("tc1 fps: "   << tc1.fps());   REQUIRE(tc1.fps() == cxxtc::fps::default_value());
+
+        // conditions for test
+        const auto [ h, m, s, f, sub, fps ] = tc1;
+        INFO("tc1 hours: "     << h);   CHECK(h   == 300);
+        INFO("tc1 minutes: "   << m);   CHECK(m   == 2);
+        INFO("tc1 seconds: "   << s);   CHECK(s   == 3);
+        INFO("tc1 frames: "    << f);   CHECK(f   == 4);
+        INFO("tc1 subframes: " << sub); CHECK(sub == 5);
+        INFO("tc1 fps: "       << fps); CHECK(fps == cxxtc::fps::default_value());
+    }
+
+    SECTION("changing fps preserves the timecode groups") {
+        // source object
+        cxxtc::timecode tc1{ "01:02:03:04.05" };
+        tc1.set_fps(cxxtc::fps::fps_30);
+
+        // conditions for test
+        INFO("tc1 ticks: "     << tc1.ticks());     CHECK(tc1.ticks()     == (1 * 60 * 60 * 30 * 100) +
+                                                                             (2 * 60 * 30 * 100) +
+                                                                             (3 * 30 * 100) +
+                                                                             (4 * 100) +
+                                                                              5);
+        INFO("tc1 hours: "     << tc1.hours());     CHECK(tc1.hours()     == 1);
+        INFO("tc1 minutes: "   << tc1.minutes());   CHECK(tc1.minutes()   == 2);
+        INFO("tc1 seconds: "   << tc1.seconds());   CHECK(tc1.seconds()   == 3);
+        INFO("tc1 frames: "    << tc1.frames());    CHECK(tc1.frames()    == 4);
+        INFO("tc1 subframes: " << tc1.subframes()); CHECK(tc1.subframes() == 5);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -591,6 +628,50 @@ TEST_CASE("cxxtc::timecode string conversions", "[chrono][timecode][conversion][
         INFO("tc3 frames: "    << tc3.frames());    CHECK(tc3.frames()    == 12);
         INFO("tc3 subframes: " << tc3.subframes()); CHECK(tc3.subframes() == 34);
     }
+
+    SECTION("single pass string parser matches the compile-time parser") {
+        // source objects
+        constexpr cxxtc::timecode tc1_const{ std::string_view{ "23:59:59:24.99" }, cxxtc::fps::fps_25 };
+        constexpr cxxtc::timecode tc2_const{ std::string_view{ "01:02:03;04" }, cxxtc::fps::fpsdf_29p97 };
+        const std::string_view tc1_view{ "23:59:59:24.99" };
+        const std::string_view tc2_view{ "01:02:03;04" };
+        cxxtc::timecode tc1{ tc1_view, cxxtc::fps::fps_25 };
+        cxxtc::timecode tc2{ tc2_view, cxxtc::fps::fpsdf_29p97 };
+
+        std::array<std::uint64_t, 5> groups{};
+        const std::array<std::string_view, 8> malformed{
+            "01:02:03:0",
+            "01:02:03:04.5",
+            "0a:02:03:04",
+            "01:02:03:04:05",
+            "01-02:03:04",
+            "01:02:03.04",
+            "01:02;03:04",
+            "01:02:03:04:56"
+        };
+
+        // pre-conditions for test
+        INFO("tc1 error: " << tc1.has_error()); REQUIRE_FALSE(tc1.has_error());
+        INFO("tc2 error: " << tc2.has_error()); REQUIRE_FALSE(tc2.has_error());
+
+        // conditions for test
+        INFO("tc1 ticks: " << tc1.ticks()); CHECK(tc1.ticks() == tc1_const.ticks());
+        INFO("tc2 ticks: " << tc2.ticks()); CHECK(tc2.ticks() == tc2_const.ticks());
+
+        for (const auto& tc : malformed) {
+            INFO("malformed label: " << tc);
+            CHECK_FALSE(cxxtc::chrono::internal::__swar_parse_label(tc.data(), tc.length(), groups));
+            CHECK(groups == std::array<std::uint64_t, 5>{});
+        }
+
+        for (std::uint64_t ticks = 0; ticks < 2160000ull * 100; ticks += 7919 * 100) {
+            const cxxtc::timecode expected{ ticks, cxxtc::fps::fps_25 };
+            const std::string tc = expected;
+            const cxxtc::timecode parsed{ std::string_view{ tc }, cxxtc::fps::fps_25 };
+
+            INFO("label: " << tc); CHECK(parsed.ticks() == expected.ticks());
+        }
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -902,6 +983,951 @@ TEST_CASE("cxxtc::timecode arithmetic operations", "[timecode][chrono][arithmeti
         // conditions for test
         INFO("tc1 value: " << tc1.ticks()); CHECK(tc1 == iterations);
     }
+
+    SECTION("pre-decrement operator carries across group boundaries") {
+        // default objects
+        cxxtc::timecode tc1{"01:00:00:00.00"};
+
+        // pre-conditions for test
+        INFO("tc1 fps: " << tc1.fps()); REQUIRE(tc1.fps() == cxxtc::fps::default_value());
+
+        // conditions for test
+        --tc1;
+        INFO("tc1 hours: "     << tc1.hours());     CHECK(tc1.hours()     == 0);
+        INFO("tc1 minutes: "   << tc1.minutes());   CHECK(tc1.minutes()   == 59);
+        INFO("tc1 seconds: "   << tc1.seconds());   CHECK(tc1.seconds()   == 59);
+        INFO("tc1 frames: "    << tc1.frames());    CHECK(tc1.frames()    == 24);
+        INFO("tc1 subframes: " << tc1.subframes()); CHECK(tc1.subframes() == 99);
+    }
+
+    SECTION("advancing by frames keeps the subframe offset") {
+        // default objects
+        cxxtc::timecode tc1{"00:00:59:24.42"};
+
+        // pre-conditions for test
+        INFO("tc1 fps: " << tc1.fps()); REQUIRE(tc1.fps() == cxxtc::fps::default_value());
+
+        // conditions for test
+        tc1.advance_frames(1);
+        INFO("tc1 minutes: "   << tc1.minutes());   CHECK(tc1.minutes()   == 1);
+        INFO("tc1 seconds: "   << tc1.seconds());   CHECK(tc1.seconds()   == 0);
+        INFO("tc1 frames: "    << tc1.frames());    CHECK(tc1.frames()    == 0);
+        INFO("tc1 subframes: " << tc1.subframes()); CHECK(tc1.subframes() == 42);
+
+        tc1.advance_frames(-26);
+        INFO("tc1 minutes: "   << tc1.minutes());   CHECK(tc1.minutes()   == 0);
+        INFO("tc1 seconds: "   << tc1.seconds());   CHECK(tc1.seconds()   == 58);
+        INFO("tc1 frames: "    << tc1.frames());    CHECK(tc1.frames()    == 24);
+        INFO("tc1 subframes: " << tc1.subframes()); CHECK(tc1.subframes() == 42);
+    }
+
+    SECTION("stepping by frames lands on a frame boundary") {
+        // default objects
+        cxxtc::timecode tc1{"00:00:00:00.42"};
+        std::size_t iterations = (59 * 25) + 24;
+        for (std::size_t i = 0; i < iterations; ++i) tc1.step_frames();
+
+        // pre-conditions for test
+        INFO("tc1 fps: " << tc1.fps()); REQUIRE(tc1.fps() == cxxtc::fps::default_value());
+
+        // conditions for test
+        INFO("tc1 value: " << tc1.ticks()); CHECK(tc1 == iterations * 100);
+        INFO("tc1 seconds: "   << tc1.seconds());   CHECK(tc1.seconds()   == 59);
+        INFO("tc1 frames: "    << tc1.frames());    CHECK(tc1.frames()    == 24);
+        INFO("tc1 subframes: " << tc1.subframes()); CHECK(tc1.subframes() == 0);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Drop-Frame Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::timecode drop-frame counting", "[timecode][chrono][dropframe]")
+{
+    SECTION("29.97 drop-frame labels skip two frames every minute except every tenth") {
+        // source objects
+        cxxtc::timecode tc1{ 1799 * 100, cxxtc::fps::fpsdf_29p97 };
+        cxxtc::timecode tc2{ 1800 * 100, cxxtc::fps::fpsdf_29p97 };
+        cxxtc::timecode tc3{ 17982 * 100, cxxtc::fps::fpsdf_29p97 };
+        cxxtc::timecode tc4{ 107892 * 100, cxxtc::fps::fpsdf_29p97 };
+        cxxtc::timecode tc5{ (107892 * 24 - 1) * 100LL, cxxtc::fps::fpsdf_29p97 };
+
+        // conditions for test
+        std::string str1 = tc1; INFO("tc1 string: " << str1); CHECK(str1 == "00:00:59;29");
+        std::string str2 = tc2; INFO("tc2 string: " << str2); CHECK(str2 == "00:01:00;02");
+        std::string str3 = tc3; INFO("tc3 string: " << str3); CHECK(str3 == "00:10:00;00");
+        std::string str4 = tc4; INFO("tc4 string: " << str4); CHECK(str4 == "01:00:00;00");
+        std::string str5 = tc5; INFO("tc5 string: " << str5); CHECK(str5 == "23:59:59;29");
+    }
+
+    SECTION("59.94 drop-frame labels skip four frames every minute except every tenth") {
+        // source objects
+        cxxtc::timecode tc1{ 3600 * 100, cxxtc::fps::fpsdf_59p94 };
+        cxxtc::timecode tc2{ 215784 * 100, cxxtc::fps::fpsdf_59p94 };
+
+        // conditions for test
+        std::string str1 = tc1; INFO("tc1 string: " << str1); CHECK(str1 == "00:01:00;04");
+        std::string str2 = tc2; INFO("tc2 string: " << str2); CHECK(str2 == "01:00:00;00");
+    }
+
+    SECTION("drop-frame labels convert back to frame counts") {
+        // source objects
+        cxxtc::timecode tc1{ "00:01:00;02", cxxtc::fps::fpsdf_29p97 };
+        cxxtc::timecode tc2{ "00:10:00;00", cxxtc::fps::fpsdf_29p97 };
+        cxxtc::timecode tc3{ "01:00:00;00.42", cxxtc::fps::fpsdf_29p97 };
+
+        // conditions for test
+        INFO("tc1 ticks: " << tc1.ticks()); CHECK(tc1.ticks() == 1800 * 100);
+        INFO("tc2 ticks: " << tc2.ticks()); CHECK(tc2.ticks() == 17982 * 100);
+        INFO("tc3 ticks: " << tc3.ticks()); CHECK(tc3.ticks() == 107892 * 100 + 42);
+        INFO("tc3 subframes: " << tc3.subframes()); CHECK(tc3.subframes() == 42);
+    }
+
+    SECTION("every drop-frame count round trips through its label") {
+        // source object
+        cxxtc::timecode tc1{ 0, cxxtc::fps::fpsdf_29p97 };
+
+        // conditions for test
+        bool round_trips = true;
+        for (std::size_t frame = 0; frame < 17982 * 2; ++frame) {
+            const std::string label = tc1;
+            const cxxtc::timecode tc2{ std::string_view{ label }, cxxtc::fps::fpsdf_29p97 };
+            round_trips = round_trips && (tc2 == tc1) && (tc1.frames() >= 2 || tc1.seconds() != 0 || tc1.minutes() % 10 == 0);
+            tc1.step_frames();
+        }
+
+        CHECK(round_trips);
+    }
+
+    SECTION("arithmetic crosses minute boundaries in frame counts") {
+        // source objects
+        cxxtc::timecode tc1{ "00:00:59;29", cxxtc::fps::fpsdf_29p97 };
+        tc1.advance_frames(1);
+
+        // conditions for test
+        INFO("tc1 minutes: " << tc1.minutes()); CHECK(tc1.minutes() == 1);
+        INFO("tc1 seconds: " << tc1.seconds()); CHECK(tc1.seconds() == 0);
+        INFO("tc1 frames: "  << tc1.frames());  CHECK(tc1.frames()  == 2);
+
+        tc1.set_minutes(10);
+        INFO("tc1 ticks: " << tc1.ticks()); CHECK(tc1.ticks() == 17982 * 100);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Compile-time FPS Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::basic_timecode with compile-time fps", "[timecode][chrono][framerate][static]")
+{
+    using timecode25 = cxxtc::basic_timecode<cxxtc::fps_constant<25>>;
+    using timecode30df = cxxtc::basic_timecode<cxxtc::fps_constant<cxxtc::fps::fpsdf_29p97>>;
+
+    SECTION("groups match the runtime fps variant") {
+        // source objects
+        timecode25 tc1{ "12:34:56:12.34" };
+        cxxtc::timecode tc2{ "12:34:56:12.34" };
+
+        // pre-conditions for test
+        INFO("tc1 fps: " << tc1.fps()); REQUIRE(tc1.fps() == cxxtc::fps::fps_25);
+
+        // conditions for test
+        INFO("tc1 ticks: "     << tc1.ticks());     CHECK(tc1.ticks()     == tc2.ticks());
+        INFO("tc1 hours: "     << tc1.hours());     CHECK(tc1.hours()     == 12);
+        INFO("tc1 minutes: "   << tc1.minutes());   CHECK(tc1.minutes()   == 34);
+        INFO("tc1 seconds: "   << tc1.seconds());   CHECK(tc1.seconds()   == 56);
+        INFO("tc1 frames: "    << tc1.frames());    CHECK(tc1.frames()    == 12);
+        INFO("tc1 subframes: " << tc1.subframes()); CHECK(tc1.subframes() == 34);
+
+        const auto [ h, m, s, f, sub, fps ] = tc1;
+        INFO("tc1 bound hours: " << h); CHECK(h == 12);
+        INFO("tc1 bound fps: " << fps); CHECK(fps == cxxtc::fps::fps_25);
+    }
+
+    SECTION("drop-frame rates can be fixed at compile time") {
+        // source object
+        timecode30df tc1{ 1800 * 100 };
+        std::string str1 = tc1;
+
+        // conditions for test
+        INFO("tc1 drop-frame: " << tc1.is_drop_frame()); CHECK(tc1.is_drop_frame());
+        INFO("tc1 string: " << str1); CHECK(str1 == "00:01:00;02");
+    }
+
+    SECTION("explicit conversion to and from runtime fps") {
+        // source objects
+        cxxtc::timecode tc1{ "01:02:03:04.05" };
+        cxxtc::timecode tc2{ "01:02:03:04.05" };
+        tc2.set_fps(cxxtc::fps::fps_30);
+
+        // destination objects
+        timecode25 tc3{ tc1 };
+        timecode25 tc4{ tc2 };
+        cxxtc::timecode tc5{ tc4 };
+
+        // conditions for test
+        INFO("tc3 ticks: " << tc3.ticks()); CHECK(tc3.ticks() == tc1.ticks());
+        INFO("tc4 ticks: " << tc4.ticks()); CHECK(tc4.ticks() == tc1.ticks());
+        INFO("tc5 fps: "   << tc5.fps());   CHECK(tc5.fps()   == cxxtc::fps::fps_25);
+        INFO("tc5 ticks: " << tc5.ticks()); CHECK(tc5.ticks() == tc1.ticks());
+    }
+
+    SECTION("runtime fps divisor tables agree with compile-time division") {
+        // source objects
+        const auto check_rate = []<auto Rate>() {
+            using constant_timecode = cxxtc::basic_timecode<cxxtc::fps_constant<Rate>>;
+            constexpr std::uint64_t ticks[] = { 0, 1, 99, 100, 2399, 2400, 179999, 180000, 1798199,
+                                                8639999, 8640000, 123456789, 21600000000ULL, 1ULL << 40 };
+
+            for (const std::uint64_t t : ticks) {
+                constant_timecode tc1{ t };
+                cxxtc::timecode tc2{ t, tc1.fps() };
+                std::string str1 = tc1;
+                std::string str2 = tc2;
+
+                // conditions for test
+                INFO("fps: " << tc2.fps() << ", ticks: " << t);
+                CHECK(tc2.hours()     == tc1.hours());
+                CHECK(tc2.minutes()   == tc1.minutes());
+                CHECK(tc2.seconds()   == tc1.seconds());
+                CHECK(tc2.frames()    == tc1.frames());
+                CHECK(tc2.subframes() == tc1.subframes());
+                CHECK(str2 == str1);
+            }
+        };
+
+        check_rate.operator()<cxxtc::fps::fps_24>();
+        check_rate.operator()<cxxtc::fps::fps_25>();
+        check_rate.operator()<cxxtc::fps::fps_30>();
+        check_rate.operator()<cxxtc::fps::fps_29p97>();
+        check_rate.operator()<cxxtc::fps::fpsdf_29p97>();
+        check_rate.operator()<cxxtc::fps::fps_60>();
+        check_rate.operator()<cxxtc::fps::fps_59p94>();
+        check_rate.operator()<cxxtc::fps::fpsdf_59p94>();
+        check_rate.operator()<cxxtc::fps::fps_23p976>();
+        check_rate.operator()<cxxtc::fps::fps_48>();
+        check_rate.operator()<cxxtc::fps::fps_50>();
+        check_rate.operator()<cxxtc::fps::fps_100>();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Time Conversion Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::timecode exact time conversions", "[timecode][chrono][conversion][time]")
+{
+    SECTION("NTSC rates convert to elapsed time with the 1000/1001 factor") {
+        // source objects
+        cxxtc::timecode tc1{ 30000 * 100, cxxtc::fps::fps_29p97 };
+        cxxtc::timecode tc2{ 24000 * 100, cxxtc::fps::fps_23p976 };
+        cxxtc::timecode tc3{ 50 * 100, cxxtc::fps::fps_50 };
+
+        // conditions for test
+        INFO("tc1 ms: " << tc1.to_time(1000)); CHECK(tc1.to_time(1000) == 1001000);
+        INFO("tc2 ms: " << tc2.to_time(1000)); CHECK(tc2.to_time(1000) == 1001000);
+        INFO("tc3 ms: " << tc3.to_time(1000)); CHECK(tc3.to_time(1000) == 1000);
+    }
+
+    SECTION("24 hours of 29.97 does not drift") {
+        // source objects
+        cxxtc::timecode tc1{ 0, cxxtc::fps::fps_29p97 };
+        cxxtc::timecode tc2{ 2589408 * 100, cxxtc::fps::fps_29p97 };
+        tc1.set_time(86400000, 1000);
+
+        // conditions for test
+        INFO("tc1 ticks: " << tc1.ticks());             CHECK(tc1.ticks()             == 258941058);
+        INFO("tc1 ms: "    << tc1.to_time(1000));       CHECK(tc1.to_time(1000)       == 86399999);
+        INFO("tc2 ns: "    << tc2.to_time(1000000000)); CHECK(tc2.to_time(1000000000) == 86399913600000);
+    }
+
+    SECTION("elapsed time round trips through the tick count") {
+        // source objects
+        cxxtc::timecode tc1{ 0, cxxtc::fps::fpsdf_59p94 };
+
+        // conditions for test
+        for (std::uint64_t frames = 0; frames < 1000000; frames += 7919) {
+            tc1.set_ticks(frames * 100);
+            const auto ns = tc1.to_time(1000000000);
+
+            cxxtc::timecode tc2{ 0, cxxtc::fps::fpsdf_59p94 };
+            tc2.set_time(ns + 1, 1000000000);
+
+            INFO("frames: " << frames << ", ns: " << ns);
+            CHECK(tc2.ticks() == tc1.ticks());
+        }
+    }
+}
+
+TEST_CASE("cxxtc::timecode std::chrono duration conversions", "[timecode][chrono][conversion][time][duration]")
+{
+    SECTION("durations of every unit use the exact rational rate") {
+        // source objects
+        const cxxtc::timecode tc1{ 30000 * 100, cxxtc::fps::fps_29p97 };
+        const cxxtc::timecode tc2{ 1440 * 100, cxxtc::fps::fps_24 };
+
+        // conditions for test
+        INFO("tc1 ns: " << tc1.to_duration<std::chrono::nanoseconds>().count());  CHECK(tc1.to_duration<std::chrono::nanoseconds>()  == std::chrono::nanoseconds{ 1001000000000 });
+        INFO("tc1 us: " << tc1.to_duration<std::chrono::microseconds>().count()); CHECK(tc1.to_duration<std::chrono::microseconds>() == std::chrono::microseconds{ 1001000000 });
+        INFO("tc1 ms: " << cxxtc::to_duration<std::chrono::milliseconds>(tc1).count()); CHECK(cxxtc::to_duration<std::chrono::milliseconds>(tc1) == std::chrono::milliseconds{ 1001000 });
+        INFO("tc1 s: "  << cxxtc::to_duration<std::chrono::seconds>(tc1).count());      CHECK(cxxtc::to_duration<std::chrono::seconds>(tc1) == std::chrono::seconds{ 1001 });
+        INFO("tc2 min: " << cxxtc::to_duration<std::chrono::minutes>(tc2).count());     CHECK(cxxtc::to_duration<std::chrono::minutes>(tc2) == std::chrono::minutes{ 1 });
+        CHECK(cxxtc::from_duration(std::chrono::minutes{ 1 }, cxxtc::fps::fps_24).ticks() == tc2.ticks());
+        CHECK(cxxtc::from_duration(std::chrono::seconds{ 1001 }, cxxtc::fps::fps_29p97).ticks() == tc1.ticks());
+    }
+
+    SECTION("elapsed time between two units is rounded as asked") {
+        // source objects
+        const cxxtc::timecode tc1{ 1 * 100, cxxtc::fps::fps_29p97 };
+        const cxxtc::timecode tc2{ 2 * 100, cxxtc::fps::fps_29p97 };
+
+        // conditions for test
+        CHECK(cxxtc::to_duration<std::chrono::milliseconds>(tc1, cxxtc::rounding::down)    == std::chrono::milliseconds{ 33 });
+        CHECK(cxxtc::to_duration<std::chrono::milliseconds>(tc1, cxxtc::rounding::nearest) == std::chrono::milliseconds{ 33 });
+        CHECK(cxxtc::to_duration<std::chrono::milliseconds>(tc1, cxxtc::rounding::up)      == std::chrono::milliseconds{ 34 });
+        CHECK(cxxtc::to_duration<std::chrono::milliseconds>(tc2, cxxtc::rounding::nearest) == std::chrono::milliseconds{ 67 });
+    }
+
+    SECTION("wall time between two frames is rounded to a whole frame as asked") {
+        // source objects
+        const std::chrono::milliseconds time{ 33 };
+
+        // conditions for test
+        CHECK(cxxtc::from_duration(time, cxxtc::fps::fps_29p97, cxxtc::rounding::down).ticks()    == 0);
+        CHECK(cxxtc::from_duration(time, cxxtc::fps::fps_29p97, cxxtc::rounding::nearest).ticks() == 100);
+        CHECK(cxxtc::from_duration(time, cxxtc::fps::fps_29p97, cxxtc::rounding::up).ticks()      == 100);
+        CHECK(cxxtc::from_duration(std::chrono::milliseconds{ 1001 }, cxxtc::fps::fps_29p97, cxxtc::rounding::up).ticks() == 30 * 100);
+    }
+
+    SECTION("jittered capture timestamps align to their frames") {
+        // source objects
+        const std::array<cxxtc::fps::type, 3> rates { cxxtc::fps::fps_23p976, cxxtc::fps::fpsdf_29p97, cxxtc::fps::fps_50 };
+
+        // conditions for test
+        for (const auto rate : rates) {
+            for (std::uint64_t frames = 0; frames < 1000000; frames += 7919) {
+                const cxxtc::timecode tc{ frames * 100, rate };
+                const auto ns = cxxtc::to_duration<std::chrono::nanoseconds>(tc, cxxtc::rounding::nearest);
+                const cxxtc::timecode early = cxxtc::from_duration(ns - std::chrono::milliseconds{ 4 }, rate, cxxtc::rounding::nearest);
+                const cxxtc::timecode late = cxxtc::from_duration(ns + std::chrono::milliseconds{ 4 }, rate, cxxtc::rounding::nearest);
+
+                INFO("frames: " << frames << ", ns: " << ns.count());
+                REQUIRE(early.ticks() == tc.ticks());
+                REQUIRE(late.ticks() == tc.ticks());
+            }
+        }
+    }
+
+    SECTION("negative durations set the error flag") {
+        // source objects
+        const cxxtc::timecode tc = cxxtc::from_duration(std::chrono::milliseconds{ -40 }, cxxtc::fps::fps_25);
+
+        // conditions for test
+        CHECK(tc.ticks() == 0);
+        CHECK(tc.has_error());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Arithmetic Policy Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::basic_timecode arithmetic policies", "[timecode][chrono][arithmetic]")
+{
+    using wrap_tc       = cxxtc::basic_timecode<cxxtc::fps, cxxtc::arithmetic::wrap_day>;
+    using saturating_tc = cxxtc::basic_timecode<cxxtc::fps, cxxtc::arithmetic::saturating>;
+    using checked_tc    = cxxtc::basic_timecode<cxxtc::fps, cxxtc::arithmetic::checked>;
+
+    SECTION("time-of-day arithmetic wraps past midnight") {
+        // source objects
+        wrap_tc tc1{ (2160000 * 100) - 1, cxxtc::fps::fps_25 };
+        wrap_tc tc2{ "23:59:59:24", cxxtc::fps::fps_25 };
+        wrap_tc tc3{ (107892 * 24 - 1) * 100LL, cxxtc::fps::fpsdf_29p97 };
+
+        // pre-conditions for test
+        ++tc1;
+        tc2.advance_frames(26);
+        tc3.step_frames(2);
+
+        // conditions for test
+        std::string str1 = tc1; INFO("tc1 string: " << str1); CHECK(str1 == "00:00:00:00");
+        std::string str2 = tc2; INFO("tc2 string: " << str2); CHECK(str2 == "00:00:01:00");
+        std::string str3 = tc3; INFO("tc3 string: " << str3); CHECK(str3 == "00:00:00;01");
+        INFO("tc1 error: " << tc1.has_error()); CHECK_FALSE(tc1.has_error());
+    }
+
+    SECTION("time-of-day arithmetic wraps back from midnight") {
+        // source objects
+        wrap_tc tc1{ 0, cxxtc::fps::fps_25 };
+        wrap_tc tc2{ 0, cxxtc::fps::fpsdf_29p97 };
+        wrap_tc tc3{ "01:00:00:00", cxxtc::fps::fps_24 };
+
+        // pre-conditions for test
+        tc1.step_frames(-1);
+        tc2 -= 100;
+        tc3 *= 25;
+
+        // conditions for test
+        std::string str1 = tc1; INFO("tc1 string: " << str1); CHECK(str1 == "23:59:59:24");
+        std::string str2 = tc2; INFO("tc2 string: " << str2); CHECK(str2 == "23:59:59;29");
+        std::string str3 = tc3; INFO("tc3 string: " << str3); CHECK(str3 == "01:00:00:00");
+    }
+
+    SECTION("saturating arithmetic clamps and flags an error") {
+        // source objects
+        saturating_tc tc1{ "00:00:01:00", cxxtc::fps::fps_24 };
+        saturating_tc tc2{ saturating_tc::max_ticks() / 2, cxxtc::fps::fps_24 };
+        saturating_tc tc3{ "00:00:01:00", cxxtc::fps::fps_24 };
+
+        // pre-conditions for test
+        tc1 -= 2500;
+        tc2 *= 4;
+        tc3 += 100;
+
+        // conditions for test
+        INFO("tc1 ticks: " << tc1.ticks()); CHECK(tc1.ticks() == 0);
+        INFO("tc2 ticks: " << tc2.ticks()); CHECK(tc2.ticks() == saturating_tc::max_ticks());
+        INFO("tc3 ticks: " << tc3.ticks()); CHECK(tc3.ticks() == 2500);
+        INFO("tc1 error: " << tc1.has_error()); CHECK(tc1.has_error());
+        INFO("tc2 error: " << tc2.has_error()); CHECK(tc2.has_error());
+        INFO("tc3 error: " << tc3.has_error()); CHECK_FALSE(tc3.has_error());
+    }
+
+    SECTION("checked arithmetic flags overflow until cleared") {
+        // source objects
+        checked_tc tc1{ 1, cxxtc::fps::fps_24 };
+        checked_tc tc2{ 100, cxxtc::fps::fps_24 };
+
+        // pre-conditions for test
+        --tc1;
+        --tc1;
+        tc2 += 100;
+
+        // conditions for test
+        INFO("tc1 error: " << tc1.has_error()); CHECK(tc1.has_error());
+        INFO("tc2 error: " << tc2.has_error()); CHECK_FALSE(tc2.has_error());
+        INFO("tc2 ticks: " << tc2.ticks());     CHECK(tc2.ticks() == 200);
+
+        tc1.clear_error();
+        INFO("tc1 error: " << tc1.has_error()); CHECK_FALSE(tc1.has_error());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Mixed Frame Rate Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::timecode mixed frame rates", "[timecode][chrono][framerate][conversion]")
+{
+    SECTION("timecodes at different rates compare by the instant they label") {
+        // source objects
+        cxxtc::timecode tc1{ "00:00:01:00", cxxtc::fps::fps_25 };
+        cxxtc::timecode tc2{ "00:00:01:00", cxxtc::fps::fps_30 };
+        cxxtc::timecode tc3{ "00:00:01:00", cxxtc::fps::fps_29p97 };
+        cxxtc::timecode tc4{ 3000, cxxtc::fps::fps_29p97 };
+        cxxtc::timecode tc5{ 3000, cxxtc::fps::fpsdf_29p97 };
+
+        // conditions for test
+        INFO("tc1: " << tc1.ticks() << ", tc2: " << tc2.ticks()); CHECK(tc1 == tc2);
+        INFO("tc1: " << tc1.ticks() << ", tc3: " << tc3.ticks()); CHECK(tc1 < tc3);
+        INFO("tc3: " << tc3.ticks() << ", tc2: " << tc2.ticks()); CHECK(tc3 > tc2);
+        INFO("tc4: " << tc4.ticks() << ", tc5: " << tc5.ticks()); CHECK(tc4 == tc5);
+        INFO("tc2: " << tc2.ticks() << ", tc1: " << tc1.ticks()); CHECK(std::is_eq(tc2 <=> tc1));
+    }
+
+    SECTION("ticks move between rates exactly with explicit rounding") {
+        // source objects
+        cxxtc::timecode tc1{ 100, cxxtc::fps::fps_25 };
+        cxxtc::timecode tc2{ 2500 * 60, cxxtc::fps::fps_25 };
+        cxxtc::timecode tc3{ 30 * 100, cxxtc::fps::fps_29p97 };
+
+        // conditions for test
+        INFO("tc1 at 30 down: "    << tc1.ticks_at(cxxtc::fps::fps_30, cxxtc::rounding::down));    CHECK(tc1.ticks_at(cxxtc::fps::fps_30, cxxtc::rounding::down)    == 120);
+        INFO("tc1 at 23.976 down: "<< tc1.ticks_at(cxxtc::fps::fps_23p976, cxxtc::rounding::down));CHECK(tc1.ticks_at(cxxtc::fps::fps_23p976, cxxtc::rounding::down)== 95);
+        INFO("tc1 at 23.976 up: "  << tc1.ticks_at(cxxtc::fps::fps_23p976, cxxtc::rounding::up));  CHECK(tc1.ticks_at(cxxtc::fps::fps_23p976, cxxtc::rounding::up)  == 96);
+        INFO("tc1 at 23.976: "     << tc1.ticks_at(cxxtc::fps::fps_23p976));                       CHECK(tc1.ticks_at(cxxtc::fps::fps_23p976)                       == 96);
+        INFO("tc2 at 24: "         << tc2.ticks_at(cxxtc::fps::fps_24));                           CHECK(tc2.ticks_at(cxxtc::fps::fps_24)                           == 2400 * 60);
+        INFO("tc3 at 30: "         << tc3.ticks_at(cxxtc::fps::fps_30));                           CHECK(tc3.ticks_at(cxxtc::fps::fps_30)                           == 3003);
+    }
+
+    SECTION("conversion to another fps keeps the instant") {
+        // source objects
+        cxxtc::timecode tc1{ "01:00:00:00", cxxtc::fps::fps_25 };
+
+        // conditions for test
+        const auto tc2 = tc1.to_fps(cxxtc::fps::fps_50);
+        const auto tc3 = tc1.to_fps(cxxtc::fps::fps_24);
+        std::string str2 = tc2; INFO("tc2 string: " << str2); CHECK(str2 == "01:00:00:00");
+        std::string str3 = tc3; INFO("tc3 string: " << str3); CHECK(str3 == "01:00:00:00");
+        INFO("tc2 fps: " << cxxtc::fps::to_string(tc2.fps())); CHECK(tc2.fps() == cxxtc::fps::fps_50);
+        INFO("tc1 == tc3: " << (tc1 == tc3)); CHECK(tc1 == tc3);
+    }
+
+    SECTION("arithmetic moves rhs to the fps of lhs") {
+        // source objects
+        cxxtc::timecode tc1{ "00:00:01:00", cxxtc::fps::fps_25 };
+        cxxtc::timecode tc2{ "00:00:01:00", cxxtc::fps::fps_30 };
+
+        // conditions for test
+        const auto tc3 = tc1 + tc2;
+        const auto tc4 = tc2 - tc1;
+        std::string str3 = tc3; INFO("tc3 string: " << str3); CHECK(str3 == "00:00:02:00");
+        INFO("tc3 fps: " << cxxtc::fps::to_string(tc3.fps())); CHECK(tc3.fps() == cxxtc::fps::fps_25);
+        INFO("tc4 ticks: " << tc4.ticks()); CHECK(tc4.ticks() == 0);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Timecode Literal Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::timecode literals", "[timecode][chrono][literals]")
+{
+    using namespace cxxtc::literals;
+
+    SECTION("literals carry the fps of their suffix") {
+        // source objects
+        constexpr auto tc1 = "01:00:00:00"_tc25;
+        constexpr auto tc2 = "00:59:59;29"_tcdf;
+        constexpr auto tc3 = "00:01:00;04"_tcdf5994;
+        constexpr auto tc4 = "00:00:01:00"_tc23976;
+
+        // conditions for test
+        INFO("tc1 fps: " << cxxtc::fps::to_string(tc1.fps())); CHECK(tc1.fps() == cxxtc::fps::fps_25);
+        INFO("tc2 fps: " << cxxtc::fps::to_string(tc2.fps())); CHECK(tc2.fps() == cxxtc::fps::fpsdf_29p97);
+        INFO("tc3 ticks: " << tc3.ticks()); CHECK(tc3.ticks() == 3600 * 100);
+        INFO("tc4 ticks: " << tc4.ticks()); CHECK(tc4.ticks() == 24 * 100);
+    }
+
+    SECTION("literals match the runtime string constructor") {
+        // source objects
+        constexpr auto tc1 = "12:34:56:12.50"_tc24;
+        cxxtc::timecode tc2{ "12:34:56:12.50", cxxtc::fps::fps_24 };
+        constexpr auto tc3 = "23:59:59;29"_tcdf;
+        cxxtc::timecode tc4{ "23:59:59;29", cxxtc::fps::fpsdf_29p97 };
+
+        // conditions for test
+        INFO("tc1 ticks: " << tc1.ticks() << ", tc2 ticks: " << tc2.ticks()); CHECK(tc1.ticks() == tc2.ticks());
+        INFO("tc3 ticks: " << tc3.ticks() << ", tc4 ticks: " << tc4.ticks()); CHECK(tc3.ticks() == tc4.ticks());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Character Conversion Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::timecode character conversions", "[timecode][chrono][conversion][string]")
+{
+    SECTION("to_chars writes the string conversion without allocating") {
+        // source objects
+        const cxxtc::timecode tc1{ "01:02:03:04", cxxtc::fps::fps_25 };
+        cxxtc::timecode tc2{ "23:59:59;29.50", cxxtc::fps::fpsdf_29p97 };
+        tc2.enable_extended_string();
+
+        char buffer[16]{};
+
+        // conditions for test
+        const auto result1 = cxxtc::to_chars(buffer, buffer + sizeof(buffer), tc1);
+        INFO("tc1 chars: " << std::string_view(buffer, result1.ptr));
+        CHECK(result1.ec == std::errc{});
+        CHECK(std::string_view(buffer, result1.ptr) == static_cast<std::string>(tc1));
+
+        const auto result2 = cxxtc::to_chars(buffer, buffer + sizeof(buffer), tc2);
+        INFO("tc2 chars: " << std::string_view(buffer, result2.ptr));
+        CHECK(result2.ec == std::errc{});
+        CHECK(std::string_view(buffer, result2.ptr) == "23:59:59;29.50");
+        CHECK(std::string_view(buffer, result2.ptr) == static_cast<std::string>(tc2));
+    }
+
+    SECTION("to_chars reports buffers that are too small") {
+        // source objects
+        const cxxtc::timecode tc{ "01:02:03:04", cxxtc::fps::fps_25 };
+        char buffer[10]{};
+
+        // conditions for test
+        const auto result = cxxtc::to_chars(buffer, buffer + sizeof(buffer), tc);
+        INFO("ptr offset: " << (result.ptr - buffer));
+        CHECK(result.ec == std::errc::value_too_large);
+        CHECK(result.ptr == buffer + sizeof(buffer));
+    }
+
+    SECTION("to_chars writes the selected format") {
+        // source objects
+        const cxxtc::timecode tc{ "00:01:00;02.25", cxxtc::fps::fpsdf_29p97 };
+        char buffer[24]{};
+
+        // conditions for test
+        auto result = tc.to_chars(buffer, buffer + sizeof(buffer), { true, false, false });
+        INFO("chars: " << std::string_view(buffer, result.ptr)); CHECK(std::string_view(buffer, result.ptr) == "00:01:00:02.25");
+
+        result = tc.to_chars(buffer, buffer + sizeof(buffer), { false, true, true });
+        INFO("chars: " << std::string_view(buffer, result.ptr)); CHECK(std::string_view(buffer, result.ptr) == "1800");
+    }
+
+    SECTION("from_chars reads the longest label at the rate of the timecode") {
+        // source objects
+        cxxtc::timecode tc1{ 0, cxxtc::fps::fps_25 };
+        cxxtc::timecode tc2{ 0, cxxtc::fps::fps_25 };
+        const std::string_view chars1{ "12:34:56:12.34 rest" };
+        const std::string_view chars2{ "12:34:56:12.3x" };
+
+        // conditions for test
+        const auto result1 = cxxtc::from_chars(chars1.data(), chars1.data() + chars1.size(), tc1);
+        INFO("tc1: " << tc1);
+        CHECK(result1.ec == std::errc{});
+        CHECK(result1.ptr == chars1.data() + 14);
+        CHECK(tc1.ticks() == cxxtc::timecode{ "12:34:56:12.34", cxxtc::fps::fps_25 }.ticks());
+
+        const auto result2 = cxxtc::from_chars(chars2.data(), chars2.data() + chars2.size(), tc2);
+        INFO("tc2: " << tc2);
+        CHECK(result2.ec == std::errc{});
+        CHECK(result2.ptr == chars2.data() + 11);
+        CHECK(tc2.ticks() == cxxtc::timecode{ "12:34:56:12", cxxtc::fps::fps_25 }.ticks());
+    }
+
+    SECTION("from_chars rejects malformed and out of range labels") {
+        // source objects
+        cxxtc::timecode tc{ "01:00:00:00", cxxtc::fps::fpsdf_29p97 };
+        const std::string_view malformed{ "01:00:0x:00" };
+        const std::string_view short_label{ "01:00:00" };
+        const std::string_view skipped{ "00:01:00;00" };
+        const std::string_view frames{ "00:00:00:30" };
+
+        // conditions for test
+        auto result = cxxtc::from_chars(malformed.data(), malformed.data() + malformed.size(), tc);
+        CHECK(result.ec == std::errc::invalid_argument);
+        CHECK(result.ptr == malformed.data());
+
+        result = cxxtc::from_chars(short_label.data(), short_label.data() + short_label.size(), tc);
+        CHECK(result.ec == std::errc::invalid_argument);
+
+        result = cxxtc::from_chars(skipped.data(), skipped.data() + skipped.size(), tc);
+        CHECK(result.ec == std::errc::result_out_of_range);
+        CHECK(result.ptr == skipped.data() + skipped.size());
+
+        result = cxxtc::from_chars(frames.data(), frames.data() + frames.size(), tc);
+        CHECK(result.ec == std::errc::result_out_of_range);
+
+        INFO("tc: " << tc); CHECK(tc.ticks() == cxxtc::timecode{ "01:00:00:00", cxxtc::fps::fpsdf_29p97 }.ticks());
+    }
+
+#if defined(__cpp_lib_format)
+    SECTION("std::format follows the format spec") {
+        // source objects
+        const cxxtc::timecode tc{ "00:01:00;02.25", cxxtc::fps::fpsdf_29p97 };
+
+        // conditions for test
+        CHECK(std::format("{}", tc) == "00:01:00;02");
+        CHECK(std::format("{:s}", tc) == "00:01:00;02.25");
+        CHECK(std::format("{:sc}", tc) == "00:01:00:02.25");
+        CHECK(std::format("{:f}", tc) == "1800");
+    }
+#endif
+}
+
+TEST_CASE("cxxtc::timecode inline string conversion", "[timecode][chrono][conversion][string]")
+{
+    SECTION("as_static_string holds the text of the string conversion") {
+        // source objects
+        const cxxtc::timecode tc1{ "01:02:03:04", cxxtc::fps::fps_25 };
+        cxxtc::timecode tc2{ "23:59:59;29.50", cxxtc::fps::fpsdf_29p97 };
+        tc2.enable_extended_string();
+
+        // conditions for test
+        const auto text1 = tc1.as_static_string();
+        const auto text2 = tc2.as_static_string();
+        INFO("text1: " << text1.view()); CHECK(text1.view() == static_cast<std::string>(tc1));
+        INFO("text2: " << text2.view()); CHECK(text2.view() == static_cast<std::string>(tc2));
+        CHECK(text1.size() == 11);
+        CHECK(text2.size() == 14);
+        CHECK(text1.data()[text1.size()] == '\0');
+    }
+
+    SECTION("static strings are values that convert to string views") {
+        // source objects
+        const cxxtc::timecode tc{ "10:00:00:00", cxxtc::fps::fps_24 };
+        std::array<cxxtc::timecode::static_string_t, 2> texts{};
+
+        // pre-conditions for test
+        texts[0] = tc.as_static_string();
+        texts[1] = texts[0];
+        const std::string_view view = texts[1];
+
+        // conditions for test
+        CHECK(view == "10:00:00:00");
+        CHECK(texts[0] == texts[1]);
+        CHECK(texts[0] > cxxtc::timecode::static_string_t{ std::string_view{ "09:59:59:23" } });
+        CHECK(cxxtc::static_string<4>{}.empty());
+    }
+}
+
+TEMPLATE_TEST_CASE("cxxtc::timecode character conversions in other char types", "[timecode][chrono][conversion][string][wide]",
+                   wchar_t, char8_t, char16_t, char32_t)
+{
+    // source objects
+    const auto widen = [](const std::string_view chars) {
+        std::basic_string<TestType> wide;
+        for (const char c : chars) wide.push_back(static_cast<TestType>(c));
+        return wide;
+    };
+
+    SECTION("parse reads labels like the narrow parser") {
+        // source objects
+        const std::array<std::string_view, 6> labels {
+            "01:02:03:04", "00:01:00;02", "23:59:59;29.50", "01:00:0x:00", "00:01:00;00", "01:00:00"
+        };
+
+        // conditions for test
+        for (const auto label : labels) {
+            const auto wide = widen(label);
+            const auto expected = cxxtc::parse(label, cxxtc::fps::fpsdf_29p97);
+            const auto result = cxxtc::parse(std::basic_string_view<TestType>{ wide }, cxxtc::fps::fpsdf_29p97);
+
+            INFO("label: " << label);
+            REQUIRE(result.has_value() == expected.has_value());
+            if (expected.has_value()) CHECK(result->ticks() == expected->ticks());
+            else CHECK(result.error() == expected.error());
+        }
+    }
+
+    SECTION("units outside ASCII are rejected") {
+        // source objects
+        std::basic_string<TestType> wide = widen("01:02:03:04");
+        wide[1] = static_cast<TestType>(0x31 + ((sizeof(TestType) > 1) ? 0x100 : 0x80));
+
+        std::basic_string<TestType> separator = widen("01:02:03:04");
+        separator[2] = static_cast<TestType>(0xba);
+
+        // conditions for test
+        const auto result1 = cxxtc::parse(std::basic_string_view<TestType>{ wide }, cxxtc::fps::fps_25);
+        const auto result2 = cxxtc::parse(std::basic_string_view<TestType>{ separator }, cxxtc::fps::fps_25);
+        REQUIRE_FALSE(result1.has_value());
+        REQUIRE_FALSE(result2.has_value());
+        CHECK(result1.error() == cxxtc::parse_error::invalid_format);
+        CHECK(result2.error() == cxxtc::parse_error::invalid_format);
+    }
+
+    SECTION("to_chars and from_chars round trip") {
+        // source objects
+        cxxtc::timecode tc1{ "23:59:59;29.50", cxxtc::fps::fpsdf_29p97 };
+        tc1.enable_extended_string();
+
+        const cxxtc::timecode tc2{ "01:02:03:04", cxxtc::fps::fps_25 };
+        TestType buffer[16]{};
+
+        // conditions for test
+        const auto written1 = cxxtc::to_chars(buffer, buffer + 16, tc1);
+        CHECK(written1.ec == std::errc{});
+        CHECK(std::basic_string_view<TestType>(buffer, written1.ptr) == widen("23:59:59;29.50"));
+
+        cxxtc::timecode result1{ 0, cxxtc::fps::fpsdf_29p97 };
+        const auto read1 = cxxtc::from_chars(static_cast<const TestType*>(buffer), written1.ptr, result1);
+        CHECK(read1.ec == std::errc{});
+        CHECK(read1.ptr == written1.ptr);
+        CHECK(result1.ticks() == tc1.ticks());
+
+        const auto written2 = cxxtc::to_chars(buffer, buffer + 16, tc2);
+        CHECK(std::basic_string_view<TestType>(buffer, written2.ptr) == widen("01:02:03:04"));
+
+        const auto small = cxxtc::to_chars(buffer, buffer + 10, tc2);
+        CHECK(small.ec == std::errc::value_too_large);
+    }
+
+    SECTION("from_chars rejects malformed labels") {
+        // source objects
+        const std::basic_string<TestType> wide = widen("01:00:0x:00");
+        cxxtc::timecode tc{ 0, cxxtc::fps::fps_25 };
+
+        // conditions for test
+        const auto result = cxxtc::from_chars(wide.data(), wide.data() + wide.size(), tc);
+        CHECK(result.ec == std::errc::invalid_argument);
+        CHECK(result.ptr == wide.data());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Stream Extraction Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::timecode stream extraction", "[timecode][chrono][conversion][stream]")
+{
+    SECTION("labels are read at the rate of the timecode") {
+        // source objects
+        std::istringstream in{ "  01:02:03:04\n00:01:00;02.50 next" };
+        cxxtc::timecode tc1{ 0, cxxtc::fps::fps_25 };
+        cxxtc::timecode tc2{ 0, cxxtc::fps::fpsdf_29p97 };
+        std::string rest;
+
+        // pre-conditions for test
+        in >> tc1 >> tc2 >> rest;
+
+        // conditions for test
+        CHECK_FALSE(in.fail());
+        INFO("tc1: " << tc1); CHECK(tc1.ticks() == cxxtc::timecode{ "01:02:03:04", cxxtc::fps::fps_25 }.ticks());
+        INFO("tc2: " << tc2); CHECK(tc2.ticks() == cxxtc::timecode{ "00:01:00;02.50", cxxtc::fps::fpsdf_29p97 }.ticks());
+        CHECK(rest == "next");
+    }
+
+    SECTION("a label at the end of the stream sets eofbit") {
+        // source objects
+        std::istringstream in{ "01:02:03:04" };
+        cxxtc::timecode tc{ 0, cxxtc::fps::fps_25 };
+
+        // pre-conditions for test
+        in >> tc;
+
+        // conditions for test
+        CHECK_FALSE(in.fail());
+        CHECK(in.eof());
+        CHECK(tc.ticks() == cxxtc::timecode{ "01:02:03:04", cxxtc::fps::fps_25 }.ticks());
+    }
+
+    SECTION("malformed and out of range labels set failbit and leave the timecode unchanged") {
+        // source objects
+        const std::array<std::string_view, 5> cases { "01:0x:03:04", "00:00:00:30", "01:02:03", "01:02:03:04.5", "00:01:00;00" };
+
+        // conditions for test
+        for (const auto c : cases) {
+            std::istringstream in{ std::string{ c } };
+            cxxtc::timecode tc{ "10:00:00:00", cxxtc::fps::fpsdf_29p97 };
+            in >> tc;
+
+            INFO("input: " << c);
+            CHECK(in.fail());
+            CHECK(tc.ticks() == cxxtc::timecode{ "10:00:00:00", cxxtc::fps::fpsdf_29p97 }.ticks());
+        }
+    }
+
+    SECTION("extraction stops at the char that can't continue a label") {
+        // source objects
+        std::istringstream in{ "01:0x:03:04" };
+        cxxtc::timecode tc{ 0, cxxtc::fps::fps_25 };
+
+        // pre-conditions for test
+        in >> tc;
+        in.clear();
+
+        // conditions for test
+        CHECK(in.get() == 'x');
+    }
+
+    SECTION("read_timecodes reads up to a count and stops at the first failure") {
+        // source objects
+        std::istringstream in1{ "01:00:00:00 01:00:00:01\n01:00:00:02 bad 01:00:00:03" };
+        std::istringstream in2{ "01:00:00:00 01:00:00:01 01:00:00:02" };
+        std::array<cxxtc::timecode, 5> timecodes{};
+        std::vector<cxxtc::timecode> container;
+
+        // pre-conditions for test
+        const std::size_t count = cxxtc::read_timecodes(in1, cxxtc::fps::fps_25, timecodes);
+        cxxtc::read_timecodes(in2, cxxtc::fps::fps_24, 2, std::back_inserter(container));
+
+        // conditions for test
+        REQUIRE(count == 3);
+        for (std::size_t i = 0; i < count; ++i) {
+            INFO("index: " << i);
+            CHECK(timecodes[i].ticks() == (90000 + i) * 100);
+            CHECK(timecodes[i].fps() == cxxtc::fps::fps_25);
+        }
+
+        REQUIRE(container.size() == 2);
+        CHECK(container[1].ticks() == (86400 + 1) * 100);
+        CHECK(container[1].fps() == cxxtc::fps::fps_24);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Checked Parsing Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::parse checks timecode strings against their rate", "[timecode][chrono][parse]")
+{
+    SECTION("valid labels match the string constructor") {
+        // source objects
+        const auto tc1 = cxxtc::parse("12:34:56:23.99", cxxtc::fps::fps_24);
+        const auto tc2 = cxxtc::parse("00:10:00;00", cxxtc::fps::fpsdf_29p97);
+        const auto tc3 = cxxtc::parse("00:01:00;04", cxxtc::fps::fpsdf_59p94);
+
+        // pre-conditions for test
+        REQUIRE(tc1.has_value());
+        REQUIRE(tc2.has_value());
+        REQUIRE(tc3.has_value());
+
+        // conditions for test
+        INFO("tc1: " << *tc1); CHECK(tc1->ticks() == cxxtc::timecode{ "12:34:56:23.99", cxxtc::fps::fps_24 }.ticks());
+        INFO("tc2: " << *tc2); CHECK(tc2->ticks() == 17982 * 100);
+        INFO("tc3: " << *tc3); CHECK(tc3->ticks() == 3600 * 100);
+        INFO("tc3 fps: " << tc3->fps()); CHECK(tc3->fps() == cxxtc::fps::fpsdf_59p94);
+    }
+
+    SECTION("malformed and out of range labels return an error") {
+        // source objects
+        struct invalid_case { std::string_view tc; cxxtc::fps::type fps; cxxtc::parse_error error; };
+        const std::array<invalid_case, 9> cases {{
+            { "",                cxxtc::fps::fps_25,       cxxtc::parse_error::invalid_length },
+            { "01:00:00",        cxxtc::fps::fps_25,       cxxtc::parse_error::invalid_length },
+            { "01:00:00:00.5",   cxxtc::fps::fps_25,       cxxtc::parse_error::invalid_length },
+            { "01:00:0x:00",     cxxtc::fps::fps_25,       cxxtc::parse_error::invalid_format },
+            { "01-00:00:00",     cxxtc::fps::fps_25,       cxxtc::parse_error::invalid_format },
+            { "01:60:00:00",     cxxtc::fps::fps_25,       cxxtc::parse_error::out_of_range },
+            { "01:00:60:00",     cxxtc::fps::fps_25,       cxxtc::parse_error::out_of_range },
+            { "01:00:00:25",     cxxtc::fps::fps_25,       cxxtc::parse_error::out_of_range },
+            { "00:01:00;01",     cxxtc::fps::fpsdf_29p97,  cxxtc::parse_error::skipped_label }
+        }};
+
+        // conditions for test
+        for (const auto& c : cases) {
+            const auto result = cxxtc::parse(c.tc, c.fps);
+            INFO("tc: " << c.tc);
+            REQUIRE_FALSE(result.has_value());
+            CHECK(result.error() == c.error);
+        }
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,215 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Batch Parser Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// runs the batch parser with one instruction set, skipping sets this CPU lacks
+auto parse_with(const cxxtc::chrono::internal::__BatchIsa isa,
+                const std::vector<std::string_view>& fields,
+                const cxxtc::fps::type rate,
+                std::vector<std::uint64_t>& ticks,
+                std::vector<std::uint64_t>& valid) -> std::size_t
+{
+    ticks.assign(fields.size(), ~std::uint64_t{0});
+    valid.assign((fields.size() + 63) / 64, ~std::uint64_t{0});
+    return cxxtc::chrono::internal::__parse_batch<cxxtc::fps>(isa,
+                                                             fields.size(),
+                                                             [&](const std::size_t i) { return fields[i]; },
+                                                             rate, ticks, valid);
+}
+
+constexpr std::array batch_isas {
+    cxxtc::chrono::internal::__BatchIsa::scalar,
+    cxxtc::chrono::internal::__BatchIsa::sse42,
+    cxxtc::chrono::internal::__BatchIsa::avx2
+};
+
+} // @END OF anonymous namespace
+
+TEST_CASE("cxxtc::parse_batch parses columns of timecode strings", "[timecode][chrono][parse][batch]")
+{
+    SECTION("valid labels match the string constructor for every kernel") {
+        // source objects
+        std::vector<std::string> storage;
+        for (std::uint64_t frames = 0; frames < 2589408; frames += 4099) {
+            cxxtc::timecode tc{ frames * 100 + (frames % 100), cxxtc::fps::fpsdf_29p97 };
+            tc.enable_extended_string(frames % 2 == 0);
+            storage.push_back(tc);
+        }
+
+        std::vector<std::string_view> fields{ storage.begin(), storage.end() };
+        std::vector<std::uint64_t> ticks;
+        std::vector<std::uint64_t> valid;
+
+        // conditions for test
+        for (const auto isa : batch_isas) {
+            if (!cxxtc::chrono::internal::__batch_isa_supported(isa)) continue;
+
+            const auto total = parse_with(isa, fields, cxxtc::fps::fpsdf_29p97, ticks, valid);
+            INFO("isa: " << static_cast<int>(isa)); CHECK(total == fields.size());
+
+            for (std::size_t i = 0; i < fields.size(); ++i) {
+                cxxtc::timecode tc{ fields[i], cxxtc::fps::fpsdf_29p97 };
+                INFO("isa: " << static_cast<int>(isa) << ", field: " << fields[i]);
+                CHECK(ticks[i] == tc.ticks());
+                CHECK(((valid[i / 64] >> (i % 64)) & 1) == 1);
+            }
+        }
+    }
+
+    SECTION("malformed and out of range labels are flagged for every kernel") {
+        // source objects
+        const std::vector<std::string_view> fields {
+            "01:00:00:00",    // valid
+            "01:00:00:00.50", // valid
+            "01:00:00:24",    // frames past the timebase
+            "01:60:00:00",    // minutes out of range
+            "01:00:60:00",    // seconds out of range
+            "01:0a:00:00",    // not a digit
+            "01-00:00:00",    // wrong separator
+            "01:00:00:00:50", // wrong subframes separator
+            "01:00:00",       // too short
+            "01:00:00:00.5",  // wrong length
+            "",               // empty
+            "00:00:00;23",    // drop-frame separator on a non-drop rate is accepted
+        };
+
+        std::vector<std::uint64_t> ticks;
+        std::vector<std::uint64_t> valid;
+
+        // conditions for test
+        for (const auto isa : batch_isas) {
+            if (!cxxtc::chrono::internal::__batch_isa_supported(isa)) continue;
+
+            const auto total = parse_with(isa, fields, cxxtc::fps::fps_24, ticks, valid);
+            INFO("isa: " << static_cast<int>(isa));
+            CHECK(total == 3);
+            CHECK(valid[0] == 0b1000'0000'0011);
+            CHECK(ticks[0] == 86400 * 100);
+            CHECK(ticks[1] == 86400 * 100 + 50);
+            CHECK(ticks[2] == 0);
+            CHECK(ticks[11] == 23 * 100);
+        }
+    }
+
+    SECTION("drop-frame labels that are skipped are flagged") {
+        // source objects
+        const std::vector<std::string_view> fields { "00:01:00;00", "00:01:00;04", "00:10:00;00", "00:01:00;03" };
+        std::vector<std::uint64_t> ticks;
+        std::vector<std::uint64_t> valid;
+
+        // conditions for test
+        for (const auto isa : batch_isas) {
+            if (!cxxtc::chrono::internal::__batch_isa_supported(isa)) continue;
+
+            parse_with(isa, fields, cxxtc::fps::fpsdf_59p94, ticks, valid);
+            INFO("isa: " << static_cast<int>(isa)); CHECK(valid[0] == 0b0110);
+        }
+    }
+
+    SECTION("fixed-stride buffers parse like spans of strings") {
+        // source objects
+        const std::string buffer = "00:00:01:00,00:00:02:00,99:99:99:99,00:00:03:00,";
+        std::array<std::uint64_t, 4> ticks{};
+        std::array<std::uint64_t, 1> valid{};
+
+        // conditions for test
+        const auto total = cxxtc::parse_batch(buffer.data(), 12, 11, 4, cxxtc::fps::fps_25, ticks, valid);
+        INFO("total: " << total);    CHECK(total == 3);
+        INFO("valid: " << valid[0]); CHECK(valid[0] == 0b1011);
+        INFO("ticks: " << ticks[0] << ", " << ticks[1] << ", " << ticks[3]);
+        CHECK(ticks[0] == 2500);
+        CHECK(ticks[1] == 5000);
+        CHECK(ticks[3] == 7500);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Batch Formatter Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::format_batch writes fixed-width timecode records", "[timecode][chrono][format][batch]")
+{
+    SECTION("records match the string conversion for every kernel and rate") {
+        // source objects
+        const std::array rates {
+            cxxtc::fps::fps_24,
+            cxxtc::fps::fps_25,
+            cxxtc::fps::fpsdf_29p97,
+            cxxtc::fps::fpsdf_59p94,
+            cxxtc::fps::fps_100
+        };
+
+        std::vector<std::uint64_t> frames;
+        for (std::uint64_t f = 0; f < 8640000; f += 7013) frames.push_back(f);
+
+        // conditions for test
+        for (const auto rate : rates) {
+            for (const auto isa : batch_isas) {
+                if (!cxxtc::chrono::internal::__batch_isa_supported(isa)) continue;
+
+                std::string out(frames.size() * 11, '\0');
+                cxxtc::chrono::internal::__format_batch<cxxtc::fps>(isa,
+                                                                    frames.size(),
+                                                                    [&](const std::size_t i) { return frames[i]; },
+                                                                    rate, out, 11);
+
+                for (std::size_t i = 0; i < frames.size(); ++i) {
+                    const std::string expected = cxxtc::timecode{ frames[i] * 100, rate };
+                    INFO("isa: " << static_cast<int>(isa) << ", rate: " << rate << ", frames: " << frames[i]);
+                    CHECK(out.substr(i * 11, 11) == expected);
+                }
+            }
+        }
+    }
+
+    SECTION("chars between records are left untouched") {
+        // source objects
+        const std::vector<std::uint64_t> frames{ 0, 25, 90000, 2159999, 1 };
+        std::string out(frames.size() * 12, '\n');
+
+        cxxtc::format_batch(frames, cxxtc::fps::fps_25, out, 12);
+
+        // conditions for test
+        INFO("out: " << out);
+        CHECK(out == "00:00:00:00\n00:00:01:00\n01:00:00:00\n23:59:59:24\n00:00:00:01\n");
+    }
+
+    SECTION("timecodes are formatted at their own rate") {
+        // source objects
+        const std::vector<cxxtc::timecode> timecodes {
+            cxxtc::timecode{ std::string_view{ "01:00:00:00" }, cxxtc::fps::fps_24 },
+            cxxtc::timecode{ std::string_view{ "01:00:00:23.50" }, cxxtc::fps::fps_24 },
+            cxxtc::timecode{ std::string_view{ "00:10:00;00" }, cxxtc::fps::fpsdf_29p97 },
+            cxxtc::timecode{ std::string_view{ "00:01:00;02" }, cxxtc::fps::fpsdf_29p97 },
+            cxxtc::timecode{ std::string_view{ "12:34:56:49" }, cxxtc::fps::fps_50 }
+        };
+
+        std::string out(timecodes.size() * 11, '\0');
+
+        cxxtc::format_batch(timecodes, out);
+
+        // conditions for test
+        INFO("out: " << out);
+        CHECK(out == "01:00:00:0001:00:00:2300:10:00;0000:01:00;0212:34:56:49");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
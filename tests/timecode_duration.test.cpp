@@ -0,0 +1,121 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <sstream>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Static Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#ifdef ENABLE_STATIC_TESTS
+
+static_assert(std::is_signed_v<cxxtc::timecode_duration::signed_type> && sizeof(cxxtc::timecode_duration::signed_type) == 8,
+              "cxxtc::timecode_duration is not backed by a signed 64-bit count");
+static_assert((-cxxtc::timecode_duration{ 100 }).is_negative(), "negated cxxtc::timecode_duration is not negative");
+
+#endif // @END OF ENABLE_STATIC_TESTS
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Duration Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::timecode_duration signed values", "[timecode][chrono][duration]")
+{
+    SECTION("negative durations keep their sign and magnitude") {
+        // source object
+        cxxtc::timecode_duration d1{ -((3600LL * 25 + 25 + 3) * 100 + 50) };
+
+        // conditions for test
+        INFO("d1 ticks: "     << d1.ticks());       CHECK(d1.ticks()       == -9002850);
+        INFO("d1 negative: "  << d1.is_negative()); CHECK(d1.is_negative());
+        INFO("d1 hours: "     << d1.hours());       CHECK(d1.hours()       == 1);
+        INFO("d1 minutes: "   << d1.minutes());     CHECK(d1.minutes()     == 0);
+        INFO("d1 seconds: "   << d1.seconds());     CHECK(d1.seconds()     == 1);
+        INFO("d1 frames: "    << d1.frames());      CHECK(d1.frames()      == 3);
+        INFO("d1 subframes: " << d1.subframes());   CHECK(d1.subframes()   == 50);
+        INFO("d1 string: "    << d1.to_string());   CHECK(d1.to_string()   == "-01:00:01:03.50");
+        INFO("d1 abs: "       << d1.abs());         CHECK(d1.abs().ticks() == 9002850);
+    }
+
+    SECTION("durations span many days") {
+        // source object
+        cxxtc::timecode_duration d1{ 3600LL * 24 * 30 * 25 * 100 };
+        std::ostringstream out;
+        out << d1;
+
+        // conditions for test
+        INFO("d1 hours: "  << d1.hours()); CHECK(d1.hours() == 720);
+        INFO("d1 string: " << out.str());  CHECK(out.str()  == "720:00:00:00");
+    }
+
+    SECTION("duration arithmetic and ordering") {
+        // source objects
+        cxxtc::timecode_duration d1{ 2500 };
+        cxxtc::timecode_duration d2{ 10000 };
+
+        // conditions for test
+        CHECK((d1 - d2).ticks() == -7500);
+        CHECK((d1 + d2).ticks() == 12500);
+        CHECK((d1 * 3).ticks()  == 7500);
+        CHECK((-d2 / 4).ticks() == -2500);
+        CHECK(d1 - d2 < d1);
+        CHECK(-d1 == cxxtc::timecode_duration{ -2500 });
+    }
+}
+
+TEST_CASE("cxxtc::timecode_duration mixed arithmetic", "[timecode][chrono][duration][arithmetic]")
+{
+    SECTION("difference of timecodes yields a signed duration") {
+        // source objects
+        cxxtc::timecode source{ "01:00:10:00" };
+        cxxtc::timecode record{ "01:00:20:12" };
+
+        // destination objects
+        const cxxtc::timecode_duration slip = cxxtc::difference(source, record);
+
+        // conditions for test
+        INFO("slip: " << slip); CHECK(slip.is_negative());
+        INFO("slip: " << slip); CHECK(slip.to_string() == "-00:00:10:12");
+        INFO("slip: " << slip); CHECK(difference(record, source) == -slip);
+    }
+
+    SECTION("offsetting a timecode by a duration keeps its fps") {
+        // source objects
+        cxxtc::timecode tc1{ "00:59:59:29", cxxtc::fps::fps_30 };
+        cxxtc::timecode_duration d1{ 100, cxxtc::fps::fps_30 };
+
+        // destination objects
+        cxxtc::timecode tc2 = tc1 + d1;
+        cxxtc::timecode tc3 = d1 + tc1;
+        cxxtc::timecode tc4 = tc2 - d1;
+        std::string str2 = tc2;
+
+        // conditions for test
+        INFO("tc2: "     << str2);      CHECK(str2      == "01:00:00:00");
+        INFO("tc2 fps: " << tc2.fps()); CHECK(tc2.fps() == cxxtc::fps::fps_30);
+        INFO("tc3: "     << tc3);       CHECK(tc3       == tc2);
+        INFO("tc4: "     << tc4);       CHECK(tc4       == tc1);
+    }
+
+    SECTION("offsetting before zero clamps and flags an error") {
+        // source objects
+        cxxtc::basic_timecode<cxxtc::fps, cxxtc::arithmetic::saturating> tc1{ "00:00:01:00" };
+        cxxtc::timecode_duration d1{ -5000 };
+
+        // conditions for test
+        tc1 += d1;
+        INFO("tc1 ticks: "    << tc1.ticks());       CHECK(tc1.ticks() == 0);
+        INFO("tc1 negative: " << tc1.is_negative()); CHECK_FALSE(tc1.is_negative());
+        INFO("tc1 error: "    << tc1.has_error());   CHECK(tc1.has_error());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,323 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Static Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#ifdef ENABLE_STATIC_TESTS
+
+// conditions for static tests
+static_assert(cxxtc::to_feet_frames(cxxtc::timecode{ 16 * 100, cxxtc::fps::fps_24 }, cxxtc::film_gauge::mm35_4perf) == cxxtc::feet_frames{ 1, 0, cxxtc::film_gauge::mm35_4perf }, "cxxtc::to_feet_frames does not count 16 frames per foot of 35mm 4-perf");
+static_assert(cxxtc::to_feet_frames(cxxtc::timecode{ 22 * 100, cxxtc::fps::fps_24 }, cxxtc::film_gauge::mm35_3perf) == cxxtc::feet_frames{ 1, 0, cxxtc::film_gauge::mm35_3perf }, "cxxtc::to_feet_frames does not start feet of 35mm 3-perf on the first whole frame");
+static_assert(cxxtc::to_feet_frames(cxxtc::timecode{ 79 * 100, cxxtc::fps::fps_24 }, cxxtc::film_gauge::mm16) == cxxtc::feet_frames{ 1, 39, cxxtc::film_gauge::mm16 }, "cxxtc::to_feet_frames does not count 40 frames per foot of 16mm");
+static_assert(cxxtc::from_feet_frames(cxxtc::feet_frames{ 3, 0, cxxtc::film_gauge::mm35_3perf }, cxxtc::fps::fps_24).ticks() == 64 * 100, "cxxtc::from_feet_frames does not convert 35mm 3-perf footage");
+
+#endif // @END OF ENABLE_STATIC_TESTS
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Feet+Frames Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::to_feet_frames converts timecodes to footage", "[timecode][chrono][film]")
+{
+    SECTION("footage of known frames for every gauge") {
+        // source objects
+        struct footage_case { std::uint64_t frames; cxxtc::film_gauge gauge; std::uint64_t feet; std::uint32_t frames_in_foot; };
+        const std::array<footage_case, 10> cases {{
+            { 0,             cxxtc::film_gauge::mm35_4perf, 0,    0  },
+            { 1234 * 16 + 5, cxxtc::film_gauge::mm35_4perf, 1234, 5  },
+            { 21,            cxxtc::film_gauge::mm35_3perf, 0,    21 },
+            { 42,            cxxtc::film_gauge::mm35_3perf, 1,    20 },
+            { 43,            cxxtc::film_gauge::mm35_3perf, 2,    0  },
+            { 64,            cxxtc::film_gauge::mm35_3perf, 3,    0  },
+            { 33,            cxxtc::film_gauge::mm35_2perf, 1,    1  },
+            { 39,            cxxtc::film_gauge::mm16,       0,    39 },
+            { 40,            cxxtc::film_gauge::mm16,       1,    0  },
+            { 90 * 60 * 24,  cxxtc::film_gauge::mm35_4perf, 8100, 0  }
+        }};
+
+        // conditions for test
+        for (const auto& c : cases) {
+            const cxxtc::feet_frames footage = cxxtc::to_feet_frames(cxxtc::timecode{ c.frames * 100, cxxtc::fps::fps_24 }, c.gauge);
+            INFO("frames: " << c.frames << ", gauge: " << static_cast<int>(c.gauge));
+            CHECK(footage.feet == c.feet);
+            CHECK(footage.frames == c.frames_in_foot);
+            CHECK(footage.gauge == c.gauge);
+        }
+    }
+
+    SECTION("subframes are dropped") {
+        // source objects
+        const cxxtc::timecode tc{ (17 * 100) + 99, cxxtc::fps::fps_24 };
+
+        // conditions for test
+        const cxxtc::feet_frames footage = cxxtc::to_feet_frames(tc, cxxtc::film_gauge::mm35_4perf);
+        INFO("feet: " << footage.feet << ", frames: " << footage.frames);
+        CHECK(footage == cxxtc::feet_frames{ 1, 1, cxxtc::film_gauge::mm35_4perf });
+    }
+
+    SECTION("footage converts back to the same frame for every gauge") {
+        // source objects
+        const std::array<cxxtc::film_gauge, 4> gauges {
+            cxxtc::film_gauge::mm35_4perf,
+            cxxtc::film_gauge::mm35_3perf,
+            cxxtc::film_gauge::mm35_2perf,
+            cxxtc::film_gauge::mm16
+        };
+
+        // conditions for test
+        for (const auto gauge : gauges) {
+            for (std::uint64_t frames = 0; frames < 2000; ++frames) {
+                const cxxtc::timecode tc{ frames * 100, cxxtc::fps::fps_23p976 };
+                const cxxtc::timecode result = cxxtc::from_feet_frames(cxxtc::to_feet_frames(tc, gauge), cxxtc::fps::fps_23p976);
+                INFO("frames: " << frames << ", gauge: " << static_cast<int>(gauge));
+                REQUIRE(result.ticks() == tc.ticks());
+                REQUIRE(result.fps() == cxxtc::fps::fps_23p976);
+            }
+        }
+    }
+}
+
+TEST_CASE("cxxtc::to_chars and cxxtc::from_chars for footage", "[timecode][chrono][film][charconv]")
+{
+    SECTION("footage is written as FEET+FF and read back") {
+        // source objects
+        const cxxtc::feet_frames footage{ 1234, 5, cxxtc::film_gauge::mm35_4perf };
+        char buffer[24]{};
+
+        // pre-conditions for test
+        const auto written = cxxtc::to_chars(buffer, buffer + sizeof(buffer), footage);
+        REQUIRE(written.ec == std::errc{});
+
+        // conditions for test
+        const std::string_view text{ buffer, written.ptr };
+        INFO("text: " << text);
+        CHECK(text == "1234+05");
+
+        cxxtc::feet_frames result{ 0, 0, cxxtc::film_gauge::mm35_4perf };
+        const auto read = cxxtc::from_chars(text.data(), text.data() + text.size(), result);
+        CHECK(read.ec == std::errc{});
+        CHECK(read.ptr == text.data() + text.size());
+        CHECK(result == footage);
+    }
+
+    SECTION("frames past the end of the foot are out of range") {
+        // source objects
+        const std::string_view text = "10+16";
+        cxxtc::feet_frames footage4{ 0, 0, cxxtc::film_gauge::mm35_4perf };
+        cxxtc::feet_frames footage16{ 0, 0, cxxtc::film_gauge::mm16 };
+
+        // conditions for test
+        const auto result4 = cxxtc::from_chars(text.data(), text.data() + text.size(), footage4);
+        const auto result16 = cxxtc::from_chars(text.data(), text.data() + text.size(), footage16);
+        CHECK(result4.ec == std::errc::result_out_of_range);
+        CHECK(footage4 == cxxtc::feet_frames{ 0, 0, cxxtc::film_gauge::mm35_4perf });
+        CHECK(result16.ec == std::errc{});
+        CHECK(footage16 == cxxtc::feet_frames{ 10, 16, cxxtc::film_gauge::mm16 });
+    }
+
+    SECTION("malformed footage is rejected and a small buffer is too small") {
+        // source objects
+        const std::string_view text = "1234-05";
+        cxxtc::feet_frames footage{};
+        char buffer[4]{};
+
+        // conditions for test
+        CHECK(cxxtc::from_chars(text.data(), text.data() + text.size(), footage).ec == std::errc::invalid_argument);
+        CHECK(cxxtc::to_chars(buffer, buffer + sizeof(buffer), cxxtc::feet_frames{ 1234, 5 }).ec == std::errc::value_too_large);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION KeyKode Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::to_keykode converts timecodes to edge numbers", "[timecode][chrono][film][keykode]")
+{
+    // source objects
+    const cxxtc::timecode sync_tc{ "01:00:00:00", cxxtc::fps::fps_24 };
+    const cxxtc::keykode sync_key{ { 'K', 'U' }, 229012, 3456, 12, cxxtc::film_gauge::mm35_4perf };
+
+    SECTION("frames after the sync frame advance the key count every foot") {
+        // conditions for test
+        const cxxtc::keykode key1 = cxxtc::to_keykode(cxxtc::timecode{ "01:00:00:03", cxxtc::fps::fps_24 }, sync_tc, sync_key);
+        const cxxtc::keykode key2 = cxxtc::to_keykode(cxxtc::timecode{ "01:00:00:04", cxxtc::fps::fps_24 }, sync_tc, sync_key);
+        const cxxtc::keykode key3 = cxxtc::to_keykode(cxxtc::timecode{ "00:59:59:04", cxxtc::fps::fps_24 }, sync_tc, sync_key);
+
+        INFO("key1: " << key1.count << "+" << key1.frames); CHECK(key1 == cxxtc::keykode{ { 'K', 'U' }, 229012, 3456, 15, cxxtc::film_gauge::mm35_4perf });
+        INFO("key2: " << key2.count << "+" << key2.frames); CHECK(key2 == cxxtc::keykode{ { 'K', 'U' }, 229012, 3457, 0, cxxtc::film_gauge::mm35_4perf });
+        INFO("key3: " << key3.count << "+" << key3.frames); CHECK(key3 == cxxtc::keykode{ { 'K', 'U' }, 229012, 3455, 8, cxxtc::film_gauge::mm35_4perf });
+    }
+
+    SECTION("16mm keys are every 20 frames") {
+        // source objects
+        const cxxtc::keykode sync16{ { 'K', 'U' }, 229012, 100, 0, cxxtc::film_gauge::mm16 };
+
+        // conditions for test
+        const cxxtc::keykode key = cxxtc::to_keykode(cxxtc::timecode{ "01:00:01:21", cxxtc::fps::fps_24 }, sync_tc, sync16);
+        INFO("key: " << key.count << "+" << key.frames);
+        CHECK(key.count == 102);
+        CHECK(key.frames == 5);
+    }
+
+    SECTION("edge numbers convert back to the same timecode") {
+        // source objects
+        const std::array<cxxtc::keykode, 3> syncs {{
+            { { 'K', 'U' }, 229012, 3456, 12, cxxtc::film_gauge::mm35_4perf },
+            { { 'K', 'J' }, 107788, 20,   7,  cxxtc::film_gauge::mm35_3perf },
+            { { 'K', 'U' }, 229012, 15,   3,  cxxtc::film_gauge::mm16 }
+        }};
+
+        // conditions for test
+        for (const auto& sync : syncs) {
+            for (std::uint64_t frames = 0; frames < 2000; ++frames) {
+                const cxxtc::timecode tc{ sync_tc.ticks() + (frames * 100), cxxtc::fps::fps_24 };
+                const cxxtc::timecode result = cxxtc::from_keykode(cxxtc::to_keykode(tc, sync_tc, sync), sync_tc, sync);
+                INFO("frames: " << frames << ", gauge: " << static_cast<int>(sync.gauge));
+                REQUIRE(result.ticks() == tc.ticks());
+                REQUIRE_FALSE(result.has_error());
+            }
+        }
+    }
+
+    SECTION("edge numbers before timecode zero set the error flag") {
+        // source objects
+        const cxxtc::timecode zero_tc{ 0, cxxtc::fps::fps_24 };
+        const cxxtc::keykode key{ { 'K', 'U' }, 229012, 3455, 0, cxxtc::film_gauge::mm35_4perf };
+
+        // conditions for test
+        const cxxtc::timecode result = cxxtc::from_keykode(key, zero_tc, sync_key);
+        CHECK(result.ticks() == 0);
+        CHECK(result.has_error());
+    }
+}
+
+TEST_CASE("cxxtc::to_chars and cxxtc::from_chars for KeyKode", "[timecode][chrono][film][keykode][charconv]")
+{
+    SECTION("edge numbers are written in human-readable form and read back") {
+        // source objects
+        const cxxtc::keykode key{ { 'K', 'U' }, 229012, 3456, 12, cxxtc::film_gauge::mm35_4perf };
+        char buffer[24]{};
+
+        // pre-conditions for test
+        const auto written = cxxtc::to_chars(buffer, buffer + sizeof(buffer), key);
+        REQUIRE(written.ec == std::errc{});
+
+        // conditions for test
+        const std::string_view text{ buffer, written.ptr };
+        INFO("text: " << text);
+        CHECK(text == "KU 22 9012 3456+12");
+
+        cxxtc::keykode result{};
+        const auto read = cxxtc::from_chars(text.data(), text.data() + text.size(), result);
+        CHECK(read.ec == std::errc{});
+        CHECK(result == key);
+    }
+
+    SECTION("counts past 9999 wrap when written") {
+        // source objects
+        const cxxtc::keykode key{ { 'K', 'U' }, 7, 10002, 0, cxxtc::film_gauge::mm35_4perf };
+        char buffer[24]{};
+
+        // conditions for test
+        const auto written = cxxtc::to_chars(buffer, buffer + sizeof(buffer), key);
+        const std::string_view text{ buffer, written.ptr };
+        INFO("text: " << text);
+        CHECK(text == "KU 00 0007 0002+00");
+    }
+
+    SECTION("malformed and out of range edge numbers are rejected") {
+        // source objects
+        const std::array<std::string_view, 4> invalid {
+            "KU 22 9012 3456-12",
+            "KU 22 9O12 3456+12",
+            "KU 22 9012 3456+1",
+            "KU229012 3456+12"
+        };
+        const std::string_view out_of_range = "KU 22 9012 3456+16";
+
+        // conditions for test
+        for (const auto text : invalid) {
+            cxxtc::keykode key{};
+            INFO("text: " << text);
+            CHECK(cxxtc::from_chars(text.data(), text.data() + text.size(), key).ec == std::errc::invalid_argument);
+            CHECK(key == cxxtc::keykode{});
+        }
+
+        cxxtc::keykode key{};
+        CHECK(cxxtc::from_chars(out_of_range.data(), out_of_range.data() + out_of_range.size(), key).ec == std::errc::result_out_of_range);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Batch Conversion Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("batch film conversions match the single conversions", "[timecode][chrono][film][batch]")
+{
+    // source objects
+    std::vector<cxxtc::timecode> timecodes;
+    for (std::uint64_t frames = 0; frames < 1000; ++frames) timecodes.emplace_back((86400 + (frames * 7)) * 100, cxxtc::fps::fps_24);
+
+    const cxxtc::timecode sync_tc{ "01:00:00:00", cxxtc::fps::fps_24 };
+    const cxxtc::keykode sync_key{ { 'K', 'J' }, 107788, 20, 7, cxxtc::film_gauge::mm35_3perf };
+
+    SECTION("feet+frames") {
+        // source objects
+        std::vector<cxxtc::feet_frames> footage(timecodes.size());
+        std::vector<cxxtc::timecode> result(timecodes.size());
+
+        // pre-conditions for test
+        cxxtc::to_feet_frames(timecodes, cxxtc::film_gauge::mm35_3perf, footage);
+        cxxtc::from_feet_frames(footage, cxxtc::fps::fps_24, result);
+
+        // conditions for test
+        for (std::size_t i = 0; i < timecodes.size(); ++i) {
+            INFO("index: " << i);
+            REQUIRE(footage[i] == cxxtc::to_feet_frames(timecodes[i], cxxtc::film_gauge::mm35_3perf));
+            REQUIRE(result[i].ticks() == timecodes[i].ticks());
+        }
+    }
+
+    SECTION("KeyKode") {
+        // source objects
+        std::vector<cxxtc::keykode> keys(timecodes.size());
+        std::vector<cxxtc::timecode> result(timecodes.size());
+
+        // pre-conditions for test
+        cxxtc::to_keykode(timecodes, sync_tc, sync_key, keys);
+        cxxtc::from_keykode(keys, sync_tc, sync_key, result);
+
+        // conditions for test
+        for (std::size_t i = 0; i < timecodes.size(); ++i) {
+            INFO("index: " << i);
+            REQUIRE(keys[i] == cxxtc::to_keykode(timecodes[i], sync_tc, sync_key));
+            REQUIRE(result[i].ticks() == timecodes[i].ticks());
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
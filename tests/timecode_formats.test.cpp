@@ -0,0 +1,111 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Static Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#ifdef ENABLE_STATIC_TESTS
+
+// conditions for static tests
+static_assert(cxxtc::detect_format("01:00:00:00") == cxxtc::text_format::label, "cxxtc::detect_format does not classify labels");
+static_assert(cxxtc::detect_format("01:00:00.00") == cxxtc::text_format::label, "cxxtc::detect_format does not classify labels with a '.' before the frames");
+static_assert(cxxtc::detect_format("01:00:00:00.50") == cxxtc::text_format::label_with_subframes, "cxxtc::detect_format does not classify labels with subframes");
+static_assert(cxxtc::detect_format("86400") == cxxtc::text_format::frames, "cxxtc::detect_format does not classify frame counts");
+static_assert(cxxtc::detect_format("01:00:00,500") == cxxtc::text_format::milliseconds, "cxxtc::detect_format does not classify milliseconds");
+static_assert(cxxtc::detect_format("01:00") == cxxtc::text_format::unknown, "cxxtc::detect_format classifies a partial label");
+static_assert(cxxtc::parse_any("90000", cxxtc::fps::fps_25)->ticks() == 90000 * 100, "cxxtc::parse_any does not read frame counts at compile time");
+
+#endif // @END OF ENABLE_STATIC_TESTS
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Multi-format Reader Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::parse_any reads timecodes in mixed formats", "[timecode][chrono][parse][formats]")
+{
+    SECTION("every format of the same instant reads as the same timecode") {
+        // source objects
+        const cxxtc::timecode expected{ "01:02:03:12", cxxtc::fps::fps_24 };
+        const std::array<std::string_view, 6> sources {
+            "01:02:03:12",
+            "01:02:03;12",
+            "01:02:03.12",
+            "01:02:03:12.00",
+            "89364",
+            "01:02:03.500"
+        };
+
+        // conditions for test
+        for (const auto source : sources) {
+            const auto tc = cxxtc::parse_any(source, cxxtc::fps::fps_24);
+            INFO("source: " << source);
+            REQUIRE(tc.has_value());
+            CHECK(tc->ticks() == expected.ticks());
+            CHECK(tc->fps() == cxxtc::fps::fps_24);
+        }
+    }
+
+    SECTION("milliseconds are converted at the exact rate") {
+        // source objects
+        const auto tc1 = cxxtc::parse_any("00:00:01,000", cxxtc::fps::fps_29p97);
+        const auto tc2 = cxxtc::parse_any("00:01:00.000", cxxtc::fps::fpsdf_29p97);
+        const auto tc3 = cxxtc::parse_any("00:00:00.041", cxxtc::fps::fps_24);
+
+        // pre-conditions for test
+        REQUIRE(tc1.has_value());
+        REQUIRE(tc2.has_value());
+        REQUIRE(tc3.has_value());
+
+        // conditions for test
+        INFO("tc1 ticks: " << tc1->ticks()); CHECK(tc1->ticks() == 2997);
+        INFO("tc2 ticks: " << tc2->ticks()); CHECK(tc2->ticks() == 179820);
+        INFO("tc3 ticks: " << tc3->ticks()); CHECK(tc3->ticks() == 98);
+    }
+
+    SECTION("malformed strings in every format return an error") {
+        // source objects
+        struct invalid_case { std::string_view tc; cxxtc::parse_error error; };
+        const std::array<invalid_case, 9> cases {{
+            { "",                 cxxtc::parse_error::invalid_format },
+            { "01:00",            cxxtc::parse_error::invalid_format },
+            { "01:00:00-00",      cxxtc::parse_error::invalid_format },
+            { "01:00:00:0x",      cxxtc::parse_error::invalid_format },
+            { "01:00:00:25",      cxxtc::parse_error::out_of_range },
+            { "12a45",            cxxtc::parse_error::invalid_format },
+            { "9999999999999999", cxxtc::parse_error::invalid_format },
+            { "01:00:0x.500",     cxxtc::parse_error::invalid_format },
+            { "01:60:00,500",     cxxtc::parse_error::out_of_range }
+        }};
+
+        // conditions for test
+        for (const auto& c : cases) {
+            const auto result = cxxtc::parse_any(c.tc, cxxtc::fps::fps_25);
+            INFO("tc: " << c.tc);
+            REQUIRE_FALSE(result.has_value());
+            CHECK(result.error() == c.error);
+        }
+    }
+
+    SECTION("frame counts past the largest timecode are out of range") {
+        // source objects
+        const auto result = cxxtc::parse_any("999999999999999", cxxtc::fps::fps_25);
+
+        // conditions for test
+        REQUIRE_FALSE(result.has_value());
+        CHECK(result.error() == cxxtc::parse_error::out_of_range);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
@@ -37,3 +37,75 @@ TEST_CASE("type conversions for chrono fps", "[timecode][chrono][framerate][conv
     REQUIRE(fps_float_60 == 60.0);    REQUIRE(fps_int_60 == 60);   REQUIRE(fps_str_60 == "60 fps");
 }
 
+
+TEST_CASE("timecode timebase for chrono fps", "[timecode][chrono][framerate][conversion][static]")
+{
+    using namespace cxxtc::chrono;
+
+    REQUIRE(fps::to_timebase(fps::fps_24)      == 24); REQUIRE_FALSE(fps::is_drop_frame(fps::fps_24));
+    REQUIRE(fps::to_timebase(fps::fps_25)      == 25); REQUIRE_FALSE(fps::is_drop_frame(fps::fps_25));
+    REQUIRE(fps::to_timebase(fps::fps_30)      == 30); REQUIRE_FALSE(fps::is_drop_frame(fps::fps_30));
+    REQUIRE(fps::to_timebase(fps::fps_29p97)   == 30); REQUIRE_FALSE(fps::is_drop_frame(fps::fps_29p97));
+    REQUIRE(fps::to_timebase(fps::fpsdf_29p97) == 30); REQUIRE(fps::is_drop_frame(fps::fpsdf_29p97));
+    REQUIRE(fps::to_timebase(fps::fps_60)      == 60); REQUIRE_FALSE(fps::is_drop_frame(fps::fps_60));
+    REQUIRE(fps::to_timebase(fps::fps_59p94)   == 60); REQUIRE_FALSE(fps::is_drop_frame(fps::fps_59p94));
+    REQUIRE(fps::to_timebase(fps::fpsdf_59p94) == 60); REQUIRE(fps::is_drop_frame(fps::fpsdf_59p94));
+
+    REQUIRE(fps::to_signed(fps::fps_59p94) == 59);   REQUIRE(fps::to_string(fps::fps_59p94) == "59.94 fps");
+    REQUIRE(fps::to_signed(fps::fpsdf_59p94) == 59); REQUIRE(fps::to_string(fps::fpsdf_59p94) == "59.94 fps drop-frame");
+}
+
+
+TEST_CASE("reverse lookups for chrono fps", "[timecode][chrono][framerate][conversion][static]")
+{
+    using namespace cxxtc::chrono;
+
+    for (const auto f : { fps::fps_24, fps::fps_25, fps::fps_30, fps::fps_29p97, fps::fpsdf_29p97,
+                          fps::fps_60, fps::fps_59p94, fps::fpsdf_59p94, fps::fps_23p976,
+                          fps::fps_48, fps::fps_50, fps::fps_100 })
+    {
+        const std::string str{ fps::to_string(f) };
+        const cxxtc::fpsint_t sign = fps::is_drop_frame(f) ? -1 : 1;
+
+        INFO("fps: " << fps::to_string(f));
+        REQUIRE(fps::from_string(fps::to_string(f)) == f);
+        REQUIRE(fps::from_string(str) == f);
+        REQUIRE(fps::from_int(sign * fps::to_signed(f)) == f);
+        REQUIRE(fps::from_float(sign * fps::to_float(f)) == f);
+    }
+
+    REQUIRE(fps::from_string(std::string_view("120 fps")) == fps::none);
+    REQUIRE(fps::from_string(std::string("")) == fps::none);
+    REQUIRE(fps::from_int(120) == fps::none);
+    REQUIRE(fps::from_float(29.96) == fps::none);
+    REQUIRE(fps::to_string(fps::none) == "NONE");
+    REQUIRE(fps::to_timebase(fps::none) == 0);
+
+    static_assert(fps::from_string(std::string_view("29.97 fps drop-frame")) == fps::fpsdf_29p97);
+    static_assert(fps::from_int(-59) == fps::fpsdf_59p94);
+    static_assert(fps::from_float(25.0) == fps::fps_25);
+}
+
+
+TEST_CASE("exact rational rates for chrono fps", "[timecode][chrono][framerate][conversion][static]")
+{
+    using namespace cxxtc::chrono;
+    using rational = fps::rational_type;
+
+    REQUIRE(fps::to_rational(fps::fps_23p976)   == rational{ 24000, 1001 }); REQUIRE(fps::to_timebase(fps::fps_23p976) == 24);
+    REQUIRE(fps::to_rational(fps::fps_24)       == rational{ 24, 1 });       REQUIRE(fps::to_timebase(fps::fps_24)     == 24);
+    REQUIRE(fps::to_rational(fps::fps_25)       == rational{ 25, 1 });       REQUIRE(fps::to_timebase(fps::fps_25)     == 25);
+    REQUIRE(fps::to_rational(fps::fps_29p97)    == rational{ 30000, 1001 }); REQUIRE(fps::to_timebase(fps::fps_29p97)  == 30);
+    REQUIRE(fps::to_rational(fps::fpsdf_29p97)  == rational{ 30000, 1001 }); REQUIRE(fps::to_timebase(fps::fpsdf_29p97) == 30);
+    REQUIRE(fps::to_rational(fps::fps_30)       == rational{ 30, 1 });       REQUIRE(fps::to_timebase(fps::fps_30)     == 30);
+    REQUIRE(fps::to_rational(fps::fps_48)       == rational{ 48, 1 });       REQUIRE(fps::to_timebase(fps::fps_48)     == 48);
+    REQUIRE(fps::to_rational(fps::fps_50)       == rational{ 50, 1 });       REQUIRE(fps::to_timebase(fps::fps_50)     == 50);
+    REQUIRE(fps::to_rational(fps::fps_59p94)    == rational{ 60000, 1001 }); REQUIRE(fps::to_timebase(fps::fps_59p94)  == 60);
+    REQUIRE(fps::to_rational(fps::fpsdf_59p94)  == rational{ 60000, 1001 }); REQUIRE(fps::to_timebase(fps::fpsdf_59p94) == 60);
+    REQUIRE(fps::to_rational(fps::fps_60)       == rational{ 60, 1 });       REQUIRE(fps::to_timebase(fps::fps_60)     == 60);
+    REQUIRE(fps::to_rational(fps::fps_100)      == rational{ 100, 1 });      REQUIRE(fps::to_timebase(fps::fps_100)    == 100);
+
+    REQUIRE_FALSE(fps::is_drop_frame(fps::fps_23p976));
+    REQUIRE(fps::to_string(fps::fps_23p976) == "23.976 fps");
+    REQUIRE(fps::to_float(fps::fps_23p976) == 23.976);
+}
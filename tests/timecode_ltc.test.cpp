@@ -0,0 +1,194 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Static Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+#ifdef ENABLE_STATIC_TESTS
+
+// conditions for static tests
+static_assert(cxxtc::encode_ltc(cxxtc::timecode{ "01:23:45:12", cxxtc::fps::fps_25 }).data == 0x0001020304050102, "cxxtc::encode_ltc does not encode at compile time");
+static_assert(cxxtc::encode_ltc(cxxtc::timecode{ 0, cxxtc::fps::fps_25 }).sync == 0xBFFC, "cxxtc::encode_ltc does not write the sync word");
+static_assert(cxxtc::decode_ltc(cxxtc::ltc_codeword{ 0x0001020304050102 }, cxxtc::fps::fps_25).value().tc.ticks()
+              == cxxtc::timecode{ "01:23:45:12", cxxtc::fps::fps_25 }.ticks(), "cxxtc::decode_ltc does not decode at compile time");
+
+#endif // @END OF ENABLE_STATIC_TESTS
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Codeword Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("cxxtc::encode_ltc packs timecodes into ST 12-1 codewords", "[timecode][ltc]")
+{
+    SECTION("codewords of known timecodes") {
+        // source objects
+        const cxxtc::timecode tc1{ "01:23:45:12", cxxtc::fps::fps_25 };
+        const cxxtc::timecode tc2{ "10:00:00;00", cxxtc::fps::fpsdf_29p97 };
+        const cxxtc::timecode tc3{ "23:59:59:29", cxxtc::fps::fps_30 };
+        const cxxtc::timecode tc4{ 0, cxxtc::fps::fps_24 };
+        const cxxtc::ltc_fields fields3{ 0x12345678, 0b101, true };
+
+        // conditions for test
+        INFO("tc1: " << std::hex << cxxtc::encode_ltc(tc1).data);          CHECK(cxxtc::encode_ltc(tc1).data == 0x0001020304050102);
+        INFO("tc2: " << std::hex << cxxtc::encode_ltc(tc2).data);          CHECK(cxxtc::encode_ltc(tc2).data == 0x0100000008000400);
+        INFO("tc3: " << std::hex << cxxtc::encode_ltc(tc3, fields3).data); CHECK(cxxtc::encode_ltc(tc3, fields3).data == 0x1A233D495D697A89);
+        INFO("tc4: " << std::hex << cxxtc::encode_ltc(tc4).data);          CHECK(cxxtc::encode_ltc(tc4).data == 0x0000000008000000);
+        CHECK(cxxtc::encode_ltc(tc1).sync == 0xBFFC);
+    }
+
+    SECTION("every codeword holds an even number of zeros") {
+        // source objects
+        const std::array<cxxtc::fps::type, 4> rates { cxxtc::fps::fps_24, cxxtc::fps::fps_25, cxxtc::fps::fpsdf_29p97, cxxtc::fps::fps_30 };
+
+        // conditions for test
+        for (const auto rate : rates) {
+            for (std::uint64_t frame = 0; frame < 100000; frame += 37) {
+                const cxxtc::ltc_fields fields{ static_cast<std::uint32_t>(frame * 2654435761u), static_cast<std::uint8_t>(frame % 8), (frame % 2) == 0 };
+                const cxxtc::ltc_codeword codeword = cxxtc::encode_ltc(cxxtc::timecode{ frame * 100, rate }, fields);
+                const int ones = std::popcount(codeword.data) + std::popcount(codeword.sync);
+                INFO("frame: " << frame);
+                REQUIRE((80 - ones) % 2 == 0);
+            }
+        }
+    }
+
+    SECTION("bytes are sent least significant bit first") {
+        // source objects
+        const cxxtc::ltc_codeword codeword = cxxtc::encode_ltc(cxxtc::timecode{ "01:23:45:12", cxxtc::fps::fps_25 });
+        const std::array<std::uint8_t, 10> expected { 0x02, 0x01, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0xFC, 0xBF };
+
+        // conditions for test
+        CHECK(codeword.to_bytes() == expected);
+        CHECK(cxxtc::ltc_codeword::from_bytes(expected) == codeword);
+    }
+}
+
+TEST_CASE("cxxtc::decode_ltc unpacks ST 12-1 codewords", "[timecode][ltc]")
+{
+    SECTION("codewords decode to the timecodes and fields they were encoded from") {
+        // source objects
+        const std::array<cxxtc::fps::type, 5> rates {
+            cxxtc::fps::fps_23p976, cxxtc::fps::fps_25, cxxtc::fps::fps_29p97, cxxtc::fps::fpsdf_29p97, cxxtc::fps::fps_30
+        };
+
+        // conditions for test
+        for (const auto rate : rates) {
+            for (std::uint64_t frame = 0; frame < 2000000; frame += 997) {
+                const cxxtc::timecode tc{ frame * 100, rate };
+                const cxxtc::ltc_fields fields{ static_cast<std::uint32_t>(frame * 2654435761u), static_cast<std::uint8_t>(frame % 8), (frame % 3) == 0 };
+                const cxxtc::ltc_codeword codeword = cxxtc::encode_ltc(tc, fields);
+                const auto result = cxxtc::decode_ltc(codeword, rate);
+
+                INFO("frame: " << frame << ", data: " << std::hex << codeword.data);
+                REQUIRE(result.has_value());
+                REQUIRE(result.value().tc.ticks() == tc.ticks());
+                REQUIRE(result.value().tc.fps() == rate);
+                REQUIRE(result.value().fields.user_bits == fields.user_bits);
+                REQUIRE(result.value().fields.binary_group_flags == fields.binary_group_flags);
+                REQUIRE(result.value().fields.color_frame == fields.color_frame);
+                REQUIRE(result.value().fields.drop_frame == tc.is_drop_frame());
+                REQUIRE(cxxtc::encode_ltc(result.value().tc, result.value().fields) == codeword);
+            }
+        }
+    }
+
+    SECTION("codewords that do not decode") {
+        // source objects
+        const cxxtc::ltc_codeword valid = cxxtc::encode_ltc(cxxtc::timecode{ "01:23:45:12", cxxtc::fps::fps_25 });
+        const cxxtc::ltc_codeword no_sync{ valid.data, 0x3FFC };
+        const cxxtc::ltc_codeword bad_digit{ valid.data | 0x000000000000000A };
+        const cxxtc::ltc_codeword bad_frames{ 0x0001020304050300 };
+        const cxxtc::ltc_codeword skipped = cxxtc::encode_ltc(cxxtc::timecode{ "00:01:00:01", cxxtc::fps::fps_29p97 });
+        const cxxtc::ltc_codeword drop_frame = cxxtc::encode_ltc(cxxtc::timecode{ "00:00:00;00", cxxtc::fps::fpsdf_29p97 });
+
+        // conditions for test
+        CHECK(cxxtc::decode_ltc(valid, cxxtc::fps::fps_25).has_value());
+        CHECK(cxxtc::decode_ltc(no_sync, cxxtc::fps::fps_25).error() == cxxtc::parse_error::invalid_format);
+        CHECK(cxxtc::decode_ltc(bad_digit, cxxtc::fps::fps_25).error() == cxxtc::parse_error::invalid_format);
+        CHECK(cxxtc::decode_ltc(bad_frames, cxxtc::fps::fps_25).error() == cxxtc::parse_error::out_of_range);
+        CHECK(cxxtc::decode_ltc(drop_frame, cxxtc::fps::fps_29p97).error() == cxxtc::parse_error::invalid_format);
+        CHECK(cxxtc::decode_ltc(valid, cxxtc::fps::fpsdf_29p97).error() == cxxtc::parse_error::invalid_format);
+
+        // a non-drop label is valid at 29.97, with the drop-frame flag set it is a skipped label
+        const cxxtc::ltc_codeword skipped_df{ skipped.data | (std::uint64_t{ 1 } << 10) };
+        CHECK(cxxtc::decode_ltc(skipped, cxxtc::fps::fps_29p97).has_value());
+        CHECK(cxxtc::decode_ltc(skipped_df, cxxtc::fps::fpsdf_29p97).error() == cxxtc::parse_error::skipped_label);
+    }
+
+    SECTION("flags of the 25 frame family") {
+        // source objects
+        const cxxtc::ltc_fields fields{ 0, 0b001 };
+        const cxxtc::ltc_codeword codeword25 = cxxtc::encode_ltc(cxxtc::timecode{ 0, cxxtc::fps::fps_25 }, fields);
+        const cxxtc::ltc_codeword codeword30 = cxxtc::encode_ltc(cxxtc::timecode{ 0, cxxtc::fps::fps_30 }, fields);
+
+        // conditions for test
+        INFO("25: " << std::hex << codeword25.data); CHECK(codeword25.data == (std::uint64_t{ 1 } << 27));
+        INFO("30: " << std::hex << codeword30.data); CHECK(codeword30.data == (std::uint64_t{ 1 } << 43));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Batch Codeword Tests --
+//
+///////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("batch LTC codecs match the single codecs", "[timecode][ltc][batch]")
+{
+    SECTION("codewords of many channels") {
+        // source objects
+        std::vector<cxxtc::timecode> timecodes;
+        std::vector<cxxtc::ltc_fields> fields;
+        for (std::uint64_t i = 0; i < 1000; ++i) {
+            timecodes.emplace_back((i * 2591) * 100, cxxtc::fps::fpsdf_29p97);
+            fields.push_back(cxxtc::ltc_fields{ static_cast<std::uint32_t>(i), static_cast<std::uint8_t>(i % 8) });
+        }
+
+        std::vector<cxxtc::ltc_codeword> codewords(timecodes.size());
+        std::vector<cxxtc::timecode> decoded(timecodes.size());
+        std::vector<cxxtc::ltc_fields> decoded_fields(timecodes.size());
+        std::vector<std::uint64_t> valid((timecodes.size() + 63) / 64);
+
+        // pre-conditions for test
+        cxxtc::encode_ltc(timecodes, fields, codewords);
+        codewords[10].sync = 0;
+        codewords[500].data |= 0xF;
+
+        // conditions for test
+        REQUIRE(cxxtc::decode_ltc(codewords, cxxtc::fps::fpsdf_29p97, decoded, decoded_fields, valid) == timecodes.size() - 2);
+        for (std::size_t i = 0; i < timecodes.size(); ++i) {
+            const bool ok = ((valid[i / 64] >> (i % 64)) & 1) != 0;
+            INFO("index: " << i);
+
+            if (i == 10 || i == 500) {
+                REQUIRE(!ok);
+                REQUIRE(decoded[i].ticks() == 0);
+                continue;
+            }
+
+            REQUIRE(ok);
+            REQUIRE(codewords[i] == cxxtc::encode_ltc(timecodes[i], fields[i]));
+            REQUIRE(decoded[i].ticks() == timecodes[i].ticks());
+            REQUIRE(decoded_fields[i].user_bits == fields[i].user_bits);
+            REQUIRE(decoded_fields[i].binary_group_flags == fields[i].binary_group_flags);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////